@@ -128,8 +128,8 @@ namespace Retro {
          *         deduced using decltype(auto), meaning it will preserve the value category and type
          *         of the final operation's result.
          */
-        template <Class U>
-        constexpr decltype(auto) operator()(TPolymorphic<U> &Value) const {
+        template <Class U, size_t Size, typename A, EPolymorphicCopyPolicy P>
+        constexpr decltype(auto) operator()(TPolymorphic<U, Size, A, P> &Value) const {
             return (*this)(*Value);
         }
 
@@ -142,8 +142,8 @@ namespace Retro {
          * @param Value A constant reference to a Polymorphic object containing the value.
          * @return The result of applying the functor to the dereferenced value stored in the Polymorphic object.
          */
-        template <Class U>
-        constexpr decltype(auto) operator()(const TPolymorphic<U> &Value) const {
+        template <Class U, size_t Size, typename A, EPolymorphicCopyPolicy P>
+        constexpr decltype(auto) operator()(const TPolymorphic<U, Size, A, P> &Value) const {
             return (*this)(*Value);
         }
 
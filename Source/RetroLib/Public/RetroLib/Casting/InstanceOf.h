@@ -99,8 +99,8 @@ namespace Retro {
          * @return A boolean value indicating the result of applying the operator
          *         to the dereferenced value of the polymorphic object.
          */
-        template <Class U, size_t Size>
-        constexpr bool operator()(const TPolymorphic<U, Size> &Polymorphic) const {
+        template <Class U, size_t Size, typename A, EPolymorphicCopyPolicy P>
+        constexpr bool operator()(const TPolymorphic<U, Size, A, P> &Polymorphic) const {
             return (*this)(*Polymorphic);
         }
 
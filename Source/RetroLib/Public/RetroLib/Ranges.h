@@ -7,4 +7,6 @@
 #include "RetroLib/Ranges/Compatibility.h"
 #include "RetroLib/Ranges/FeatureBridge.h"
 #include "RetroLib/Ranges/RangeBasics.h"
+#include "RetroLib/Ranges/Segments.h"
+#include "RetroLib/Ranges/SizeHint.h"
 #include "RetroLib/Ranges/Views.h"
@@ -2,7 +2,12 @@
 
 #pragma once
 
+#include "RetroLib/Ranges/Algorithm/ExecutionPolicy.h"
 #include "RetroLib/Ranges/Algorithm/FindFirst.h"
 #include "RetroLib/Ranges/Algorithm/NameAliases.h"
 #include "RetroLib/Ranges/Algorithm/Reduce.h"
+#include "RetroLib/Ranges/Algorithm/ReduceMany.h"
+#include "RetroLib/Ranges/Algorithm/SimdReduce.h"
 #include "RetroLib/Ranges/Algorithm/To.h"
+#include "RetroLib/Ranges/Algorithm/ToArray.h"
+#include "RetroLib/Ranges/Algorithm/TransformReduce.h"
@@ -0,0 +1,81 @@
+/**
+ * @file ExecutionPolicy.h
+ * @brief Execution policies used to select how a range algorithm is run.
+ *
+ * @author Retro & Chill
+ * https://github.com/retroandchill
+ */
+#pragma once
+
+#if !RETROLIB_WITH_MODULES
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <thread>
+#include <type_traits>
+#endif
+
+#ifndef RETROLIB_EXPORT
+#define RETROLIB_EXPORT
+#endif
+
+namespace Retro::Ranges {
+    /**
+     * Execution policy that runs an algorithm on the calling thread, in order.
+     */
+    RETROLIB_EXPORT struct FSequencedPolicy {};
+
+    /**
+     * Execution policy that allows an algorithm to split its work into chunks that are processed on multiple threads.
+     * Algorithms fall back to running sequentially when the input cannot be split cheaply (i.e. it is not a sized
+     * random-access range), or when it is too small to be worth the cost of starting threads.
+     */
+    RETROLIB_EXPORT struct FParallelPolicy {
+        /**
+         * The default minimum number of elements that each thread should process.
+         */
+        static constexpr size_t DEFAULT_MIN_CHUNK_SIZE = 1 << 14;
+
+        /**
+         * The maximum number of threads to use, including the calling thread. Zero uses the hardware concurrency.
+         */
+        size_t MaxThreads = 0;
+
+        /**
+         * The minimum number of elements that each thread should process.
+         */
+        size_t MinChunkSize = DEFAULT_MIN_CHUNK_SIZE;
+
+        /**
+         * Determines the number of chunks to split a range of the given size into.
+         *
+         * @param Size The number of elements in the range
+         * @return The number of chunks, where one means the range should be processed sequentially
+         */
+        size_t GetNumChunks(size_t Size) const noexcept {
+            // Querying the hardware concurrency is a system call on some platforms, so only do it once
+            static const size_t HardwareThreads = std::max(std::thread::hardware_concurrency(), 1u);
+            size_t Threads = MaxThreads != 0 ? MaxThreads : HardwareThreads;
+            return std::max<size_t>(std::min(Threads, Size / std::max<size_t>(MinChunkSize, 1)), 1);
+        }
+    };
+
+    /**
+     * Execution policy for running an algorithm sequentially.
+     */
+    RETROLIB_EXPORT constexpr FSequencedPolicy Seq;
+
+    /**
+     * Execution policy for running an algorithm in parallel, using the default settings.
+     */
+    RETROLIB_EXPORT constexpr FParallelPolicy Par;
+
+    /**
+     * Concept for a type that is one of the execution policies.
+     *
+     * @tparam T The type to check
+     */
+    RETROLIB_EXPORT template <typename T>
+    concept ExecutionPolicy =
+        std::same_as<std::remove_cvref_t<T>, FSequencedPolicy> || std::same_as<std::remove_cvref_t<T>, FParallelPolicy>;
+} // namespace retro::ranges
@@ -9,13 +9,49 @@
 
 #include "RetroLib/Functional/CreateBinding.h"
 #include "RetroLib/Functional/ExtensionMethods.h"
+#include "RetroLib/Ranges/Algorithm/ExecutionPolicy.h"
+#include "RetroLib/Ranges/Algorithm/SimdReduce.h"
 #include "RetroLib/Ranges/FeatureBridge.h"
+#include "RetroLib/Ranges/Segments.h"
+
+#if !RETROLIB_WITH_MODULES
+#include <exception>
+#include <optional>
+#include <thread>
+#include <vector>
+#endif
 
 #ifndef RETROLIB_EXPORT
 #define RETROLIB_EXPORT
 #endif
 
 namespace Retro::Ranges {
+    namespace Detail {
+        template <bool bStrict, typename R, typename I, typename F>
+        constexpr auto ReduceSequential(R &&Range, I &&Identity, F &Functor) {
+            if constexpr (SimdReducible<R, I, F, bStrict>) {
+                if (!std::is_constant_evaluated()) {
+                    return ReduceVectorized<SimdReduceOp<std::remove_cvref_t<F>>>(
+                        std::ranges::data(Range), std::ranges::size(Range), std::decay_t<I>(std::forward<I>(Identity)));
+                }
+            }
+
+            auto Result = std::forward<I>(Identity);
+            if constexpr (SegmentedRange<R>) {
+                // Each segment gets its own loop, which is vectorized for contiguous segments
+                Ranges::ForEachSegment(Range, [&Result, &Functor](auto &Segment) {
+                    Result = ReduceSequential<bStrict>(Segment, std::move(Result), Functor);
+                    return true;
+                });
+            } else {
+                for (auto &&Value : std::forward<R>(Range)) {
+                    Result = std::invoke(Functor, std::move(Result), std::forward<decltype(Value)>(Value));
+                }
+            }
+            return Result;
+        }
+    } // namespace Detail
+
     /**
      * @brief Reduces a range of elements into a single value by applying a functor
      * iteratively.
@@ -24,6 +60,11 @@ namespace Retro::Ranges {
      * to combine the elements in the range into a single aggregated result.
      * The functor is applied in left-to-right order.
      *
+     * When a contiguous range of arithmetic values is reduced with Add, Multiply, Min or Max, and the identity has
+     * the same type as the elements, the reduction is performed by a vectorized kernel instead. For floating point
+     * values this reassociates the operations, so the result may differ in the last bits from a left-to-right fold.
+     * Pass Ranges::Seq as the execution policy, or define RETROLIB_WITH_STRICT_FLOAT_REDUCE, to avoid this.
+     *
      * @tparam R The type of the range.
      * @tparam I The type of the identity value.
      * @tparam F The type of the functor.
@@ -36,11 +77,8 @@ namespace Retro::Ranges {
         requires std::invocable<F, I, TRangeCommonReference<R>> &&
                  std::convertible_to<std::invoke_result_t<F, I, TRangeCommonReference<R>>, I>
     constexpr auto Reduce(R &&Range, I &&Identity, F Functor) {
-        auto Result = std::forward<I>(Identity);
-        for (auto &&Value : std::forward<R>(Range)) {
-            Result = std::invoke(Functor, std::move(Result), std::forward<decltype(Value)>(Value));
-        }
-        return Result;
+        return Detail::ReduceSequential<RETROLIB_WITH_STRICT_FLOAT_REDUCE>(std::forward<R>(Range),
+                                                                           std::forward<I>(Identity), Functor);
     }
 
     /**
@@ -85,6 +123,150 @@ namespace Retro::Ranges {
                       CreateBinding<Functor>(std::forward<A>(Args)...));
     }
 
+    namespace Detail {
+        template <typename R, typename I, typename F>
+        concept ParallelReducible =
+            std::ranges::random_access_range<R> && std::ranges::sized_range<R> && std::copy_constructible<F> &&
+            std::constructible_from<std::decay_t<I>, TRangeCommonReference<R>> &&
+            std::invocable<F &, std::decay_t<I>, std::decay_t<I>> &&
+            std::convertible_to<std::invoke_result_t<F &, std::decay_t<I>, std::decay_t<I>>, std::decay_t<I>>;
+
+        template <typename T, typename R, typename F>
+        T ReduceChunk(T Result, R &Range, std::ptrdiff_t First, std::ptrdiff_t Last, F &Functor) {
+            if constexpr (SimdReducible<R &, T, F>) {
+                return ReduceVectorized<SimdReduceOp<std::remove_cvref_t<F>>>(
+                    std::ranges::data(Range) + First, static_cast<size_t>(Last - First), std::move(Result));
+            }
+
+            auto Begin = std::ranges::begin(Range);
+            for (auto It = Begin + First; It != Begin + Last; ++It) {
+                Result = std::invoke(Functor, std::move(Result), *It);
+            }
+            return Result;
+        }
+
+        template <typename R, typename I, typename F>
+        auto ParallelReduce(const FParallelPolicy &Policy, R &Range, I &&Identity, F &Functor) {
+            using FResult = std::decay_t<I>;
+            auto Size = static_cast<std::ptrdiff_t>(std::ranges::size(Range));
+            auto NumChunks = static_cast<std::ptrdiff_t>(Policy.GetNumChunks(static_cast<size_t>(Size)));
+            if (NumChunks <= 1) {
+                return ReduceChunk<FResult>(std::forward<I>(Identity), Range, 0, Size, Functor);
+            }
+
+            // Only the first chunk starts from the identity, so the identity does not need to be neutral. Each other
+            // chunk is seeded with its own first element.
+            std::vector<std::optional<FResult>> Partials(NumChunks);
+            std::vector<std::exception_ptr> Exceptions(NumChunks);
+            auto ReducePartial = [&Range, &Partials, &Exceptions, Size, NumChunks](std::ptrdiff_t Chunk, F Local) {
+                try {
+                    auto First = Size * Chunk / NumChunks;
+                    auto Last = Size * (Chunk + 1) / NumChunks;
+                    FResult Seed(*(std::ranges::begin(Range) + First));
+                    Partials[Chunk].emplace(ReduceChunk<FResult>(std::move(Seed), Range, First + 1, Last, Local));
+                } catch (...) {
+                    Exceptions[Chunk] = std::current_exception();
+                }
+            };
+
+            std::vector<std::jthread> Workers;
+            Workers.reserve(NumChunks - 1);
+            for (std::ptrdiff_t Chunk = 1; Chunk < NumChunks; Chunk++) {
+                Workers.emplace_back(ReducePartial, Chunk, Functor);
+            }
+
+            // If the first chunk throws, the workers are still joined by their destructors before unwinding
+            FResult Result = ReduceChunk<FResult>(std::forward<I>(Identity), Range, 0, Size / NumChunks, Functor);
+            Workers.clear();
+
+            for (std::ptrdiff_t Chunk = 1; Chunk < NumChunks; Chunk++) {
+                if (Exceptions[Chunk] != nullptr) {
+                    std::rethrow_exception(Exceptions[Chunk]);
+                }
+                Result = std::invoke(Functor, std::move(Result), std::move(*Partials[Chunk]));
+            }
+            return Result;
+        }
+    } // namespace Detail
+
+    /**
+     * @brief Reduces a range of elements into a single value by applying a functor, using the given execution policy.
+     *
+     * With the parallel policy, a sized random-access range is split into contiguous chunks that are each reduced on
+     * their own thread, after which the partial results are combined from left to right using the same functor. The
+     * functor must therefore be associative and be able to combine two partial results, however the identity does not
+     * need to be a neutral element, as it is only applied once. Any other range is reduced sequentially.
+     *
+     * With the sequenced policy, the range is always reduced strictly from left to right, so that floating point
+     * results are bitwise reproducible.
+     *
+     * @tparam P The type of the execution policy.
+     * @tparam R The type of the range.
+     * @tparam I The type of the identity value.
+     * @tparam F The type of the functor.
+     * @param Policy The execution policy to run the reduction with.
+     * @param Range The range of elements to be reduced.
+     * @param Identity The initial identity value used in the reduction process.
+     * @param Functor A callable object that specifies how to combine two elements.
+     * @return The final aggregated result of the reduction operation.
+     */
+    RETROLIB_EXPORT template <ExecutionPolicy P, std::ranges::input_range R, typename I, HasFunctionCallOperator F>
+        requires std::invocable<F, I, TRangeCommonReference<R>> &&
+                 std::convertible_to<std::invoke_result_t<F, I, TRangeCommonReference<R>>, I>
+    auto Reduce(P &&Policy, R &&Range, I &&Identity, F Functor) {
+        if constexpr (std::same_as<std::remove_cvref_t<P>, FParallelPolicy> && Detail::ParallelReducible<R, I, F>) {
+            return Detail::ParallelReduce(Policy, Range, std::forward<I>(Identity), Functor);
+        } else {
+            constexpr bool bStrict =
+                std::same_as<std::remove_cvref_t<P>, FSequencedPolicy> || RETROLIB_WITH_STRICT_FLOAT_REDUCE;
+            return Detail::ReduceSequential<bStrict>(std::forward<R>(Range), std::forward<I>(Identity), Functor);
+        }
+    }
+
+    /**
+     * Reduces a given range using the given execution policy, by performing a folding operation using the specified
+     * identity value and a binding created from the provided arguments.
+     *
+     * @param Policy The execution policy to run the reduction with.
+     * @param Range The range of elements to be reduced.
+     * @param Identity The identity value used for the reduction operation.
+     * @param PrimeArg The primary argument to create a binding for the reduction operation.
+     * @param Args Additional arguments to create a binding for the reduction.
+     * @return The result of folding the elements in the range using the specified identity value
+     * and the created binding.
+     */
+    RETROLIB_EXPORT template <ExecutionPolicy P, std::ranges::input_range R, typename I, typename T, typename... A>
+        requires std::invocable<TBindingType<T, A...>, I, TRangeCommonReference<R>> &&
+                 std::convertible_to<std::invoke_result_t<TBindingType<T, A...>, I, TRangeCommonReference<R>>, I>
+    auto Reduce(P &&Policy, R &&Range, I &&Identity, T &&PrimeArg, A &&...Args) {
+        return Reduce(std::forward<P>(Policy), std::forward<R>(Range), std::forward<I>(Identity),
+                      CreateBinding(std::forward<T>(PrimeArg), std::forward<A>(Args)...));
+    }
+
+    /**
+     * Reduces the provided range using the given execution policy, with the specified identity and arguments to
+     * create a binding using the Functor.
+     *
+     * @tparam P The type of the execution policy.
+     * @tparam R The type of the range to reduce.
+     * @tparam I The type of the identity value.
+     * @tparam A The types of additional arguments required for creating a binding.
+     * @param Policy The execution policy to run the reduction with.
+     * @param Range The range of elements to process with reduction.
+     * @param Identity The initial value for the reduction operation.
+     * @param Args Additional arguments for creating the binding for the Functor.
+     * @return The result of reducing the range using the identity value and the created binding.
+     */
+    RETROLIB_EXPORT template <auto Functor, ExecutionPolicy P, std::ranges::input_range R, typename I, typename... A>
+        requires HasFunctionCallOperator<decltype(Functor)> &&
+                 std::invocable<TConstBindingType<Functor, A...>, I, TRangeCommonReference<R>> &&
+                 std::convertible_to<
+                     std::invoke_result_t<TConstBindingType<Functor, A...>, I, TRangeCommonReference<R>>, I>
+    auto Reduce(P &&Policy, R &&Range, I &&Identity, A &&...Args) {
+        return Reduce(std::forward<P>(Policy), std::forward<R>(Range), std::forward<I>(Identity),
+                      CreateBinding<Functor>(std::forward<A>(Args)...));
+    }
+
     /**
      * @struct FReduceInvoker
      *
@@ -131,6 +313,29 @@ namespace Retro::Ranges {
         constexpr auto operator()(R &&Range, I &&Identity, A &&...Args) const {
             return Reduce(std::forward<R>(Range), std::forward<I>(Identity), std::forward<A>(Args)...);
         }
+
+        /**
+         * @brief Invokes the `reduce` operation on a given range using the given execution policy.
+         *
+         * @tparam R The type representing the input range, which must satisfy `std::ranges::input_range`.
+         * @tparam P The type of the execution policy.
+         * @tparam I The type of the identity element used in the `reduce` operation.
+         * @tparam A Variadic template for additional argument types forwarded to the `reduce` function.
+         *
+         * @param Range The input range over which the `reduce` operation will be applied.
+         * @param Policy The execution policy to run the reduction with.
+         * @param Identity The identity element used for the `reduce` algorithm.
+         * @param Args Additional arguments forwarded to the `reduce` operation.
+         *
+         * @return The result of the `reduce` operation.
+         */
+        template <std::ranges::input_range R, ExecutionPolicy P, typename I, typename... A>
+            requires std::invocable<TBindingType<A...>, I, TRangeCommonReference<R>> &&
+                     std::convertible_to<std::invoke_result_t<TBindingType<A...>, I, TRangeCommonReference<R>>, I>
+        auto operator()(R &&Range, P &&Policy, I &&Identity, A &&...Args) const {
+            return Reduce(std::forward<P>(Policy), std::forward<R>(Range), std::forward<I>(Identity),
+                          std::forward<A>(Args)...);
+        }
     };
 
     /**
@@ -204,6 +409,30 @@ namespace Retro::Ranges {
         constexpr auto operator()(R &&Range, I &&Identity, A &&...Args) const {
             return Reduce<Functor>(std::forward<R>(Range), std::forward<I>(Identity), std::forward<A>(Args)...);
         }
+
+        /**
+         * @brief Invokes the `reduce` operation on a provided input range using the given execution policy.
+         *
+         * @tparam R The type of the input range; must satisfy `std::ranges::input_range`.
+         * @tparam P The type of the execution policy.
+         * @tparam I The type of the identity element.
+         * @tparam A Variadic types for additional arguments forwarded to the `reduce` operation.
+         *
+         * @param Range The input range on which the `reduce` operation is applied.
+         * @param Policy The execution policy to run the reduction with.
+         * @param Identity The identity element used as the initial value for the `reduce` operation.
+         * @param Args Additional arguments forwarded to the provided functor during the reduction.
+         *
+         * @return The result of the `reduce` operation.
+         */
+        template <std::ranges::input_range R, ExecutionPolicy P, typename I, typename... A>
+            requires std::invocable<TConstBindingType<Functor, A...>, I, TRangeCommonReference<R>> &&
+                     std::convertible_to<
+                         std::invoke_result_t<TConstBindingType<Functor, A...>, I, TRangeCommonReference<R>>, I>
+        auto operator()(R &&Range, P &&Policy, I &&Identity, A &&...Args) const {
+            return Reduce<Functor>(std::forward<P>(Policy), std::forward<R>(Range), std::forward<I>(Identity),
+                                   std::forward<A>(Args)...);
+        }
     };
 
     /**
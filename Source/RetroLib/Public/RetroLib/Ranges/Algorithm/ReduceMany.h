@@ -0,0 +1,259 @@
+/**
+ * @file ReduceMany.h
+ * @brief Functional chain component used for reducing a range down to several values in a single pass.
+ *
+ * @author Retro & Chill
+ * https://github.com/retroandchill
+ */
+#pragma once
+
+#include "RetroLib/Functional/CreateBinding.h"
+#include "RetroLib/Functional/ExtensionMethods.h"
+#include "RetroLib/Ranges/FeatureBridge.h"
+#include "RetroLib/Ranges/Segments.h"
+#include "RetroLib/RetroLibMacros.h"
+
+#if !RETROLIB_WITH_MODULES
+#include <array>
+#include <functional>
+#include <ranges>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#endif
+
+#ifndef RETROLIB_EXPORT
+#define RETROLIB_EXPORT
+#endif
+
+namespace Retro::Ranges {
+    /**
+     * Saturation predicate for reducers that always need to see every element of the range.
+     */
+    RETROLIB_EXPORT struct FNeverSaturated {
+        /**
+         * Checks if the accumulated value can no longer change.
+         *
+         * @return Always false
+         */
+        template <typename T>
+        constexpr bool operator()(const T &) const noexcept {
+            return false;
+        }
+    };
+
+    /**
+     * @brief A single aggregate computed by ReduceMany, consisting of an identity, a functor and an optional
+     * saturation predicate.
+     *
+     * Once the saturation predicate returns true for the accumulated value the functor is no longer applied to it,
+     * and when every reducer passed to ReduceMany is saturated the traversal of the range stops early.
+     *
+     * @tparam I The type of the identity, which is also the type of the result
+     * @tparam F The type of the functor used to combine the accumulated value with an element
+     * @tparam P The type of the saturation predicate
+     */
+    RETROLIB_EXPORT template <typename I, typename F, typename P = FNeverSaturated>
+    struct TReducer {
+        /**
+         * The type of the value produced by this reducer.
+         */
+        using FResult = I;
+
+        /**
+         * Whether this reducer is able to saturate before the end of the range.
+         */
+        static constexpr bool bCanSaturate = !std::same_as<P, FNeverSaturated>;
+
+        /**
+         * The initial value of the reduction.
+         */
+        I Identity;
+
+        /**
+         * The functor used to combine the accumulated value with an element.
+         */
+        RETROLIB_NO_UNIQUE_ADDRESS F Functor;
+
+        /**
+         * The predicate used to check if the accumulated value can no longer change.
+         */
+        RETROLIB_NO_UNIQUE_ADDRESS P IsSaturated;
+    };
+
+    /**
+     * Creates a reducer from an identity and a functor.
+     *
+     * @param Identity The initial value of the reduction
+     * @param Functor The functor used to combine the accumulated value with an element
+     * @return The created reducer
+     */
+    RETROLIB_EXPORT template <typename I, typename F>
+        requires HasFunctionCallOperator<std::decay_t<F>>
+    constexpr auto Reducer(I &&Identity, F &&Functor) {
+        return TReducer<std::decay_t<I>, std::decay_t<F>>{std::forward<I>(Identity), std::forward<F>(Functor), {}};
+    }
+
+    /**
+     * Creates a reducer from an identity, a functor and a saturation predicate.
+     *
+     * @param Identity The initial value of the reduction
+     * @param Functor The functor used to combine the accumulated value with an element
+     * @param IsSaturated The predicate used to check if the accumulated value can no longer change
+     * @return The created reducer
+     */
+    RETROLIB_EXPORT template <typename I, typename F, typename P>
+        requires HasFunctionCallOperator<std::decay_t<F>> && std::predicate<std::decay_t<P> &, const std::decay_t<I> &>
+    constexpr auto Reducer(I &&Identity, F &&Functor, P &&IsSaturated) {
+        return TReducer<std::decay_t<I>, std::decay_t<F>, std::decay_t<P>>{
+            std::forward<I>(Identity), std::forward<F>(Functor), std::forward<P>(IsSaturated)};
+    }
+
+    /**
+     * Creates a reducer from an identity and a compile-time functor, with the additional arguments bound to the
+     * functor.
+     *
+     * @tparam Functor The functor used to combine the accumulated value with an element
+     * @param Identity The initial value of the reduction
+     * @param Args Additional arguments for creating the binding for the functor
+     * @return The created reducer
+     */
+    RETROLIB_EXPORT template <auto Functor, typename I, typename... A>
+        requires HasFunctionCallOperator<decltype(Functor)>
+    constexpr auto Reducer(I &&Identity, A &&...Args) {
+        return Reducer(std::forward<I>(Identity), CreateBinding<Functor>(std::forward<A>(Args)...));
+    }
+
+    template <typename>
+    struct TIsReducer : std::false_type {};
+
+    template <typename I, typename F, typename P>
+    struct TIsReducer<TReducer<I, F, P>> : std::true_type {};
+
+    /**
+     * Concept for a reducer that can be applied to the elements of the given range.
+     *
+     * @tparam T The type of the reducer
+     * @tparam R The type of the range
+     */
+    RETROLIB_EXPORT template <typename T, typename R>
+    concept ReducerFor =
+        TIsReducer<std::remove_cvref_t<T>>::value &&
+        std::invocable<decltype(std::declval<std::remove_cvref_t<T> &>().Functor) &,
+                       typename std::remove_cvref_t<T>::FResult, std::ranges::range_reference_t<R> &> &&
+        std::convertible_to<std::invoke_result_t<decltype(std::declval<std::remove_cvref_t<T> &>().Functor) &,
+                                                 typename std::remove_cvref_t<T>::FResult,
+                                                 std::ranges::range_reference_t<R> &>,
+                            typename std::remove_cvref_t<T>::FResult>;
+
+    /**
+     * @brief Reduces a range into several values at once, traversing the range a single time.
+     *
+     * Every reducer sees the elements of the range in order, exactly as if the range was passed to Reduce once for
+     * each of them, which makes this suitable for ranges that can only be traversed once, such as generators. If a
+     * reducer has a saturation predicate it stops being applied as soon as it is saturated, and if every reducer is
+     * saturated the rest of the range is not visited at all.
+     *
+     * @tparam R The type of the range
+     * @tparam T The types of the reducers
+     * @param Range The range of elements to be reduced
+     * @param Reducers The reducers to apply to each element
+     * @return A tuple containing the result of each reducer, in the order they were passed in
+     */
+    RETROLIB_EXPORT template <std::ranges::input_range R, ReducerFor<R>... T>
+        requires(sizeof...(T) > 0)
+    constexpr auto ReduceMany(R &&Range, T &&...Reducers) {
+        std::tuple<typename std::remove_cvref_t<T>::FResult...> Results(std::forward<T>(Reducers).Identity...);
+        std::array<bool, sizeof...(T)> Saturated = {};
+        constexpr bool bAllCanSaturate = (std::remove_cvref_t<T>::bCanSaturate && ...);
+
+        auto CheckSaturated = [&]<size_t N>(auto &Reducer) {
+            if constexpr (std::remove_cvref_t<decltype(Reducer)>::bCanSaturate) {
+                Saturated[N] = std::invoke(Reducer.IsSaturated, std::as_const(std::get<N>(Results)));
+            }
+        };
+
+        auto Apply = [&]<size_t N>(auto &Reducer, auto &Value) {
+            if constexpr (std::remove_cvref_t<decltype(Reducer)>::bCanSaturate) {
+                if (Saturated[N]) {
+                    return;
+                }
+            }
+
+            auto &Result = std::get<N>(Results);
+            Result = std::invoke(Reducer.Functor, std::move(Result), Value);
+            if constexpr (std::remove_cvref_t<decltype(Reducer)>::bCanSaturate) {
+                Saturated[N] = std::invoke(Reducer.IsSaturated, std::as_const(Result));
+            }
+        };
+
+        [&]<size_t... N>(std::index_sequence<N...>) {
+            // Reducers can already be saturated at their identity, in which case they never see an element
+            (CheckSaturated.template operator()<N>(Reducers), ...);
+            if constexpr (bAllCanSaturate) {
+                if ((Saturated[N] && ...)) {
+                    return;
+                }
+            }
+
+            // Each segment gets its own loop, so the loop body does not need to dispatch on the active segment
+            Ranges::ForEachSegment(Range, [&](auto &Segment) {
+                for (auto &&Value : Segment) {
+                    (Apply.template operator()<N>(Reducers, Value), ...);
+                    if constexpr (bAllCanSaturate) {
+                        if ((Saturated[N] && ...)) {
+                            return false;
+                        }
+                    }
+                }
+                return true;
+            });
+        }(std::index_sequence_for<T...>{});
+
+        return Results;
+    }
+
+    /**
+     * @struct FReduceManyInvoker
+     *
+     * @brief A function object that reduces a range into several values at once.
+     *
+     * This struct is used to implement the pipe form of ReduceMany.
+     */
+    struct FReduceManyInvoker {
+        /**
+         * @brief Invokes the `ReduceMany` operation on a given range.
+         *
+         * @tparam R The type representing the input range, which must satisfy `std::ranges::input_range`.
+         * @tparam T The types of the reducers.
+         *
+         * @param Range The input range over which the operation will be applied.
+         * @param Reducers The reducers to apply to each element.
+         *
+         * @return A tuple containing the result of each reducer.
+         */
+        template <std::ranges::input_range R, ReducerFor<R>... T>
+            requires(sizeof...(T) > 0)
+        constexpr auto operator()(R &&Range, T &&...Reducers) const {
+            return ReduceMany(std::forward<R>(Range), std::forward<T>(Reducers)...);
+        }
+    };
+
+    /**
+     * @brief A constant expression instance of the FReduceManyInvoker type.
+     */
+    constexpr FReduceManyInvoker ReduceManyFunction;
+
+    /**
+     * Creates an extension method that reduces a range into several values at once.
+     *
+     * @tparam T The types of the reducers
+     * @param Reducers The reducers to apply to each element
+     * @return An extension method that can be applied to a range using the pipe operator.
+     */
+    RETROLIB_EXPORT template <typename... T>
+        requires(sizeof...(T) > 0) && (TIsReducer<std::remove_cvref_t<T>>::value && ...)
+    constexpr auto ReduceMany(T &&...Reducers) {
+        return ExtensionMethod<ReduceManyFunction>(std::forward<T>(Reducers)...);
+    }
+} // namespace retro::ranges
@@ -0,0 +1,512 @@
+/**
+ * @file SimdReduce.h
+ * @brief Vectorized kernels used by Reduce for the built-in arithmetic functors over contiguous ranges.
+ *
+ * @author Retro & Chill
+ * https://github.com/retroandchill
+ */
+#pragma once
+
+#include "RetroLib/Functional/CreateBinding.h"
+#include "RetroLib/Utils/Operators.h"
+
+/**
+ * When enabled, reducing a contiguous range of arithmetic values with Add, Multiply, Min or Max is dispatched to a
+ * vectorized kernel instead of a serial loop.
+ */
+#ifndef RETROLIB_WITH_SIMD_REDUCE
+#define RETROLIB_WITH_SIMD_REDUCE 1
+#endif
+
+/**
+ * When enabled, floating point ranges are never reassociated by Reduce, so that the result is always bitwise identical
+ * to a left-to-right fold. Passing Ranges::Seq to Reduce has the same effect for a single call.
+ */
+#ifndef RETROLIB_WITH_STRICT_FLOAT_REDUCE
+#define RETROLIB_WITH_STRICT_FLOAT_REDUCE 0
+#endif
+
+#if RETROLIB_WITH_SIMD_REDUCE && (defined(__x86_64__) || defined(_M_X64))
+#define RETROLIB_SIMD_REDUCE_X86 1
+#else
+#define RETROLIB_SIMD_REDUCE_X86 0
+#endif
+
+// AVX2 code is compiled into the binary regardless of the target flags, and is only run on CPUs that support it
+#if RETROLIB_SIMD_REDUCE_X86 && defined(_MSC_VER) && !defined(__clang__)
+#define RETROLIB_SIMD_REDUCE_AVX2 1
+#define RETROLIB_TARGET_AVX2
+#elif RETROLIB_SIMD_REDUCE_X86 && (defined(__GNUC__) || defined(__clang__)) && !defined(_MSC_VER)
+#define RETROLIB_SIMD_REDUCE_AVX2 1
+#define RETROLIB_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define RETROLIB_SIMD_REDUCE_AVX2 0
+#endif
+
+#if !RETROLIB_WITH_MODULES
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <ranges>
+#include <type_traits>
+
+#if RETROLIB_SIMD_REDUCE_X86
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+#endif
+#endif
+
+namespace Retro::Ranges::Detail {
+    /**
+     * The operations that have a vectorized reduction kernel.
+     */
+    enum class ESimdReduceOp : uint8_t { None, Add, Multiply, Min, Max };
+
+    template <typename F>
+    constexpr ESimdReduceOp SimdReduceOp = ESimdReduceOp::None;
+
+    template <>
+    constexpr ESimdReduceOp SimdReduceOp<FAddFunction> = ESimdReduceOp::Add;
+
+    template <>
+    constexpr ESimdReduceOp SimdReduceOp<FMultiplyFunction> = ESimdReduceOp::Multiply;
+
+    template <>
+    constexpr ESimdReduceOp SimdReduceOp<FMinFunction> = ESimdReduceOp::Min;
+
+    template <>
+    constexpr ESimdReduceOp SimdReduceOp<FMaxFunction> = ESimdReduceOp::Max;
+
+    template <typename F>
+    constexpr ESimdReduceOp SimdReduceOp<TWrappedFunctor<F>> = SimdReduceOp<F>;
+
+    template <auto Functor>
+    constexpr ESimdReduceOp SimdReduceOp<TSimpleFunctorBinding<Functor>> =
+        SimdReduceOp<std::remove_cvref_t<decltype(Functor)>>;
+
+    template <typename T>
+    concept SimdReduceElement = (std::integral<T> || std::floating_point<T>) && !std::same_as<T, bool> &&
+                                (sizeof(T) == 4 || sizeof(T) == 8);
+
+    /**
+     * Checks if reducing the given range with the given identity and functor can be dispatched to a vectorized
+     * kernel. The identity has to be of the same type as the elements, so that the arithmetic is performed in the
+     * exact same type as the serial fold would use.
+     *
+     * @tparam R The type of the range
+     * @tparam I The type of the identity
+     * @tparam F The type of the functor
+     * @tparam bStrict Whether floating point values must be reduced strictly from left to right
+     */
+    template <typename R, typename I, typename F, bool bStrict = RETROLIB_WITH_STRICT_FLOAT_REDUCE>
+    concept SimdReducible =
+        (RETROLIB_WITH_SIMD_REDUCE != 0) && std::ranges::contiguous_range<R> && std::ranges::sized_range<R> &&
+        SimdReduceElement<std::ranges::range_value_t<R>> &&
+        std::same_as<std::decay_t<I>, std::ranges::range_value_t<R>> &&
+        std::same_as<std::remove_cvref_t<std::ranges::range_reference_t<R>>, std::ranges::range_value_t<R>> &&
+        SimdReduceOp<std::remove_cvref_t<F>> != ESimdReduceOp::None &&
+        !(bStrict && std::floating_point<std::ranges::range_value_t<R>>);
+
+    template <ESimdReduceOp Op, typename T>
+    constexpr T ApplySimdReduceOp(T Lhs, T Rhs) {
+        if constexpr (Op == ESimdReduceOp::Min) {
+            return Rhs < Lhs ? Rhs : Lhs;
+        } else if constexpr (Op == ESimdReduceOp::Max) {
+            return Lhs < Rhs ? Rhs : Lhs;
+        } else if constexpr (std::integral<T>) {
+            // Signed overflow wraps in the vector registers, so the scalar code does the same instead of invoking UB
+            using FUnsigned = std::make_unsigned_t<T>;
+            if constexpr (Op == ESimdReduceOp::Add) {
+                return static_cast<T>(static_cast<FUnsigned>(Lhs) + static_cast<FUnsigned>(Rhs));
+            } else {
+                return static_cast<T>(static_cast<FUnsigned>(Lhs) * static_cast<FUnsigned>(Rhs));
+            }
+        } else if constexpr (Op == ESimdReduceOp::Add) {
+            return Lhs + Rhs;
+        } else {
+            return Lhs * Rhs;
+        }
+    }
+
+    /**
+     * Gets the value that the accumulators of a kernel start from. Min and Max start from the initial value, which can
+     * be combined any number of times, so that a NaN anywhere in the data is skipped in every lane the same way the
+     * serial fold skips it. Add and Multiply start from their identity, so that the initial value is only combined
+     * once.
+     */
+    template <ESimdReduceOp Op, typename T>
+    constexpr T SimdReduceSeed(T Init) {
+        if constexpr (Op == ESimdReduceOp::Min || Op == ESimdReduceOp::Max) {
+            return Init;
+        } else if constexpr (Op == ESimdReduceOp::Add) {
+            // Negative zero is the additive identity for floating point values, since -0 + +0 is +0 but -0 + -0 is -0
+            return std::floating_point<T> ? static_cast<T>(-0.0) : static_cast<T>(0);
+        } else {
+            return static_cast<T>(1);
+        }
+    }
+
+    /**
+     * Portable kernel that breaks the dependency chain of the fold by using several independent accumulators.
+     */
+    template <ESimdReduceOp Op, typename T>
+    T ReduceScalarKernel(const T *Data, size_t Size, T Init) {
+        constexpr size_t NumAccumulators = 4;
+        if (Size < NumAccumulators) {
+            for (size_t i = 0; i < Size; i++) {
+                Init = ApplySimdReduceOp<Op>(Init, Data[i]);
+            }
+            return Init;
+        }
+
+        const T Seed = SimdReduceSeed<Op>(Init);
+        T Acc0 = Seed;
+        T Acc1 = Seed;
+        T Acc2 = Seed;
+        T Acc3 = Seed;
+        // Bounding the loops by the end of the last full block lets the compiler prove the tail stays in range
+        const size_t BlockEnd = Size - Size % NumAccumulators;
+        for (size_t i = 0; i < BlockEnd; i += NumAccumulators) {
+            Acc0 = ApplySimdReduceOp<Op>(Acc0, Data[i]);
+            Acc1 = ApplySimdReduceOp<Op>(Acc1, Data[i + 1]);
+            Acc2 = ApplySimdReduceOp<Op>(Acc2, Data[i + 2]);
+            Acc3 = ApplySimdReduceOp<Op>(Acc3, Data[i + 3]);
+        }
+
+        T Result = ApplySimdReduceOp<Op>(Init, ApplySimdReduceOp<Op>(ApplySimdReduceOp<Op>(Acc0, Acc1),
+                                                                     ApplySimdReduceOp<Op>(Acc2, Acc3)));
+        for (size_t i = BlockEnd; i < Size; i++) {
+            Result = ApplySimdReduceOp<Op>(Result, Data[i]);
+        }
+        return Result;
+    }
+
+#if RETROLIB_SIMD_REDUCE_X86
+    // Selected through specialization, since passing the vector types as template arguments drops their attributes
+    template <typename T>
+    struct TSse2Vector {
+        using Type = __m128i;
+    };
+
+    template <>
+    struct TSse2Vector<float> {
+        using Type = __m128;
+    };
+
+    template <>
+    struct TSse2Vector<double> {
+        using Type = __m128d;
+    };
+
+    /**
+     * Lane operations for SSE2, which is part of the x86-64 baseline.
+     *
+     * @tparam T The element type
+     */
+    template <typename T>
+    struct TSse2Lanes {
+        static constexpr bool bFloat = std::same_as<T, float>;
+        static constexpr bool bDouble = std::same_as<T, double>;
+        static constexpr size_t Width = 16 / sizeof(T);
+        using FVector = typename TSse2Vector<T>::Type;
+
+        template <ESimdReduceOp Op>
+        static constexpr bool Supports = std::floating_point<T> || Op == ESimdReduceOp::Add;
+
+        static FVector Load(const T *Ptr) {
+            if constexpr (bFloat) {
+                return _mm_loadu_ps(Ptr);
+            } else if constexpr (bDouble) {
+                return _mm_loadu_pd(Ptr);
+            } else {
+                return _mm_loadu_si128(reinterpret_cast<const __m128i *>(Ptr));
+            }
+        }
+
+        static void Store(T *Ptr, FVector Vector) {
+            if constexpr (bFloat) {
+                _mm_storeu_ps(Ptr, Vector);
+            } else if constexpr (bDouble) {
+                _mm_storeu_pd(Ptr, Vector);
+            } else {
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(Ptr), Vector);
+            }
+        }
+
+        static FVector Broadcast(T Value) {
+            if constexpr (bFloat) {
+                return _mm_set1_ps(Value);
+            } else if constexpr (bDouble) {
+                return _mm_set1_pd(Value);
+            } else if constexpr (sizeof(T) == 4) {
+                return _mm_set1_epi32(static_cast<int32_t>(Value));
+            } else {
+                return _mm_set1_epi64x(static_cast<int64_t>(Value));
+            }
+        }
+
+        // The accumulator is the second operand of min/max, which makes each lane behave like the scalar functors:
+        // ties and NaN values keep the accumulator, and a NaN accumulator stays NaN. This only matches the serial fold
+        // because the accumulators are seeded from the initial value instead of from the data.
+        template <ESimdReduceOp Op>
+        static FVector Apply(FVector Acc, FVector Value) {
+            if constexpr (bFloat) {
+                if constexpr (Op == ESimdReduceOp::Add) {
+                    return _mm_add_ps(Acc, Value);
+                } else if constexpr (Op == ESimdReduceOp::Multiply) {
+                    return _mm_mul_ps(Acc, Value);
+                } else if constexpr (Op == ESimdReduceOp::Min) {
+                    return _mm_min_ps(Value, Acc);
+                } else {
+                    return _mm_max_ps(Value, Acc);
+                }
+            } else if constexpr (bDouble) {
+                if constexpr (Op == ESimdReduceOp::Add) {
+                    return _mm_add_pd(Acc, Value);
+                } else if constexpr (Op == ESimdReduceOp::Multiply) {
+                    return _mm_mul_pd(Acc, Value);
+                } else if constexpr (Op == ESimdReduceOp::Min) {
+                    return _mm_min_pd(Value, Acc);
+                } else {
+                    return _mm_max_pd(Value, Acc);
+                }
+            } else if constexpr (sizeof(T) == 4) {
+                return _mm_add_epi32(Acc, Value);
+            } else {
+                return _mm_add_epi64(Acc, Value);
+            }
+        }
+    };
+
+    /**
+     * Kernel that keeps four vector accumulators in flight, so that each lane of each accumulator forms its own
+     * independent dependency chain.
+     */
+    template <ESimdReduceOp Op, typename T>
+    T ReduceSse2Kernel(const T *Data, size_t Size, T Init) {
+        using FLanes = TSse2Lanes<T>;
+        constexpr size_t Stride = FLanes::Width * 4;
+        if (Size < Stride) {
+            return ReduceScalarKernel<Op>(Data, Size, Init);
+        }
+
+        const auto Seed = FLanes::Broadcast(SimdReduceSeed<Op>(Init));
+        auto Acc0 = Seed;
+        auto Acc1 = Seed;
+        auto Acc2 = Seed;
+        auto Acc3 = Seed;
+        const size_t BlockEnd = Size - Size % Stride;
+        for (size_t i = 0; i < BlockEnd; i += Stride) {
+            Acc0 = FLanes::template Apply<Op>(Acc0, FLanes::Load(Data + i));
+            Acc1 = FLanes::template Apply<Op>(Acc1, FLanes::Load(Data + i + FLanes::Width));
+            Acc2 = FLanes::template Apply<Op>(Acc2, FLanes::Load(Data + i + FLanes::Width * 2));
+            Acc3 = FLanes::template Apply<Op>(Acc3, FLanes::Load(Data + i + FLanes::Width * 3));
+        }
+        Acc0 = FLanes::template Apply<Op>(FLanes::template Apply<Op>(Acc0, Acc1),
+                                          FLanes::template Apply<Op>(Acc2, Acc3));
+
+        T Lanes[FLanes::Width];
+        FLanes::Store(Lanes, Acc0);
+        T Result = Init;
+        for (auto Lane : Lanes) {
+            Result = ApplySimdReduceOp<Op>(Result, Lane);
+        }
+        for (size_t i = BlockEnd; i < Size; i++) {
+            Result = ApplySimdReduceOp<Op>(Result, Data[i]);
+        }
+        return Result;
+    }
+#endif
+
+#if RETROLIB_SIMD_REDUCE_AVX2
+    template <typename T>
+    struct TAvx2Vector {
+        using Type = __m256i;
+    };
+
+    template <>
+    struct TAvx2Vector<float> {
+        using Type = __m256;
+    };
+
+    template <>
+    struct TAvx2Vector<double> {
+        using Type = __m256d;
+    };
+
+    /**
+     * Lane operations for AVX2. Every function is compiled for AVX2 regardless of the target flags.
+     *
+     * @tparam T The element type
+     */
+    template <typename T>
+    struct TAvx2Lanes {
+        static constexpr bool bFloat = std::same_as<T, float>;
+        static constexpr bool bDouble = std::same_as<T, double>;
+        static constexpr bool bSigned = std::is_signed_v<T>;
+        static constexpr size_t Width = 32 / sizeof(T);
+        using FVector = typename TAvx2Vector<T>::Type;
+
+        // There are no 64-bit integer multiply, min or max instructions before AVX-512
+        template <ESimdReduceOp Op>
+        static constexpr bool Supports = std::floating_point<T> || Op == ESimdReduceOp::Add || sizeof(T) == 4;
+
+        RETROLIB_TARGET_AVX2 static FVector Load(const T *Ptr) {
+            if constexpr (bFloat) {
+                return _mm256_loadu_ps(Ptr);
+            } else if constexpr (bDouble) {
+                return _mm256_loadu_pd(Ptr);
+            } else {
+                return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(Ptr));
+            }
+        }
+
+        RETROLIB_TARGET_AVX2 static void Store(T *Ptr, FVector Vector) {
+            if constexpr (bFloat) {
+                _mm256_storeu_ps(Ptr, Vector);
+            } else if constexpr (bDouble) {
+                _mm256_storeu_pd(Ptr, Vector);
+            } else {
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(Ptr), Vector);
+            }
+        }
+
+        RETROLIB_TARGET_AVX2 static FVector Broadcast(T Value) {
+            if constexpr (bFloat) {
+                return _mm256_set1_ps(Value);
+            } else if constexpr (bDouble) {
+                return _mm256_set1_pd(Value);
+            } else if constexpr (sizeof(T) == 4) {
+                return _mm256_set1_epi32(static_cast<int32_t>(Value));
+            } else {
+                return _mm256_set1_epi64x(static_cast<int64_t>(Value));
+            }
+        }
+
+        template <ESimdReduceOp Op>
+        RETROLIB_TARGET_AVX2 static FVector Apply(FVector Acc, FVector Value) {
+            if constexpr (bFloat) {
+                if constexpr (Op == ESimdReduceOp::Add) {
+                    return _mm256_add_ps(Acc, Value);
+                } else if constexpr (Op == ESimdReduceOp::Multiply) {
+                    return _mm256_mul_ps(Acc, Value);
+                } else if constexpr (Op == ESimdReduceOp::Min) {
+                    return _mm256_min_ps(Value, Acc);
+                } else {
+                    return _mm256_max_ps(Value, Acc);
+                }
+            } else if constexpr (bDouble) {
+                if constexpr (Op == ESimdReduceOp::Add) {
+                    return _mm256_add_pd(Acc, Value);
+                } else if constexpr (Op == ESimdReduceOp::Multiply) {
+                    return _mm256_mul_pd(Acc, Value);
+                } else if constexpr (Op == ESimdReduceOp::Min) {
+                    return _mm256_min_pd(Value, Acc);
+                } else {
+                    return _mm256_max_pd(Value, Acc);
+                }
+            } else if constexpr (sizeof(T) == 8) {
+                return _mm256_add_epi64(Acc, Value);
+            } else if constexpr (Op == ESimdReduceOp::Add) {
+                return _mm256_add_epi32(Acc, Value);
+            } else if constexpr (Op == ESimdReduceOp::Multiply) {
+                return _mm256_mullo_epi32(Acc, Value);
+            } else if constexpr (Op == ESimdReduceOp::Min) {
+                return bSigned ? _mm256_min_epi32(Acc, Value) : _mm256_min_epu32(Acc, Value);
+            } else {
+                return bSigned ? _mm256_max_epi32(Acc, Value) : _mm256_max_epu32(Acc, Value);
+            }
+        }
+    };
+
+    /**
+     * AVX2 version of ReduceSse2Kernel.
+     */
+    template <ESimdReduceOp Op, typename T>
+    RETROLIB_TARGET_AVX2 T ReduceAvx2Kernel(const T *Data, size_t Size, T Init) {
+        using FLanes = TAvx2Lanes<T>;
+        constexpr size_t Stride = FLanes::Width * 4;
+        if (Size < Stride) {
+            return ReduceScalarKernel<Op>(Data, Size, Init);
+        }
+
+        const auto Seed = FLanes::Broadcast(SimdReduceSeed<Op>(Init));
+        auto Acc0 = Seed;
+        auto Acc1 = Seed;
+        auto Acc2 = Seed;
+        auto Acc3 = Seed;
+        const size_t BlockEnd = Size - Size % Stride;
+        for (size_t i = 0; i < BlockEnd; i += Stride) {
+            Acc0 = FLanes::template Apply<Op>(Acc0, FLanes::Load(Data + i));
+            Acc1 = FLanes::template Apply<Op>(Acc1, FLanes::Load(Data + i + FLanes::Width));
+            Acc2 = FLanes::template Apply<Op>(Acc2, FLanes::Load(Data + i + FLanes::Width * 2));
+            Acc3 = FLanes::template Apply<Op>(Acc3, FLanes::Load(Data + i + FLanes::Width * 3));
+        }
+        Acc0 = FLanes::template Apply<Op>(FLanes::template Apply<Op>(Acc0, Acc1),
+                                          FLanes::template Apply<Op>(Acc2, Acc3));
+
+        T Lanes[FLanes::Width];
+        FLanes::Store(Lanes, Acc0);
+        T Result = Init;
+        for (auto Lane : Lanes) {
+            Result = ApplySimdReduceOp<Op>(Result, Lane);
+        }
+        for (size_t i = BlockEnd; i < Size; i++) {
+            Result = ApplySimdReduceOp<Op>(Result, Data[i]);
+        }
+        return Result;
+    }
+
+    /**
+     * Checks if the CPU and the operating system support AVX2.
+     *
+     * @return Whether AVX2 instructions can be run
+     */
+    inline bool HasAvx2() noexcept {
+        static const bool bHasAvx2 = [] {
+#if defined(_MSC_VER) && !defined(__clang__)
+            int Info[4];
+            __cpuid(Info, 1);
+            constexpr int OsxSaveAndAvx = (1 << 27) | (1 << 28);
+            if ((Info[2] & OsxSaveAndAvx) != OsxSaveAndAvx || (_xgetbv(0) & 0x6) != 0x6) {
+                return false;
+            }
+            __cpuidex(Info, 7, 0);
+            return (Info[1] & (1 << 5)) != 0;
+#else
+            return __builtin_cpu_supports("avx2") != 0;
+#endif
+        }();
+        return bHasAvx2;
+    }
+#endif
+
+    /**
+     * Reduces a contiguous block of values using the best kernel available on the running CPU.
+     *
+     * @tparam Op The operation to reduce with
+     * @tparam T The element type
+     * @param Data The first element of the block
+     * @param Size The number of elements in the block
+     * @param Init The value the reduction starts from
+     * @return The result of the reduction
+     */
+    template <ESimdReduceOp Op, SimdReduceElement T>
+    T ReduceVectorized(const T *Data, size_t Size, T Init) {
+#if RETROLIB_SIMD_REDUCE_AVX2
+        if constexpr (TAvx2Lanes<T>::template Supports<Op>) {
+            if (HasAvx2()) {
+                return ReduceAvx2Kernel<Op>(Data, Size, Init);
+            }
+        }
+#endif
+#if RETROLIB_SIMD_REDUCE_X86
+        if constexpr (TSse2Lanes<T>::template Supports<Op>) {
+            return ReduceSse2Kernel<Op>(Data, Size, Init);
+        }
+#endif
+        return ReduceScalarKernel<Op>(Data, Size, Init);
+    }
+} // namespace Retro::Ranges::Detail
@@ -11,9 +11,18 @@
 #include "RetroLib/Functional/ExtensionMethods.h"
 #include "RetroLib/Ranges/Concepts.h"
 #include "RetroLib/Ranges/FeatureBridge.h"
+#include "RetroLib/Ranges/Segments.h"
+#include "RetroLib/Ranges/SizeHint.h"
 
 #if !RETROLIB_WITH_MODULES
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <iterator>
 #include <map>
+#include <memory>
+#include <type_traits>
+#include <vector>
 #endif
 
 #ifndef RETROLIB_EXPORT
@@ -21,37 +30,6 @@
 #endif
 
 namespace Retro::Ranges {
-    /**
-     * @struct TIsMap
-     * @brief A type trait structure that indicates whether a given type is a map.
-     *
-     * This struct is a specialization of `std::false_type` and represents a compile-time
-     * boolean constant. It will evaluate to `false` for any type unless explicitly
-     * specialized for map-like types.
-     *
-     * Use this structure to perform type-checking operations for map-like types
-     * in template metaprogramming scenarios.
-     */
-    RETROLIB_EXPORT template <template <typename...> typename>
-    struct TIsMap : std::false_type {};
-
-    /**
-     * @brief Trait to identify the std::map type.
-     *
-     * This specialization of the IsMap struct evaluates to std::true_type
-     * for the std::map type, indicating that the given type is considered
-     * a map-like container. It provides a convenient way to detect maps
-     * in template metaprogramming.
-     *
-     * @tparam std::map The specialization is explicitly defined for std::map.
-     *
-     * The primary use of this struct is to help with type identification
-     * and enable conditional compilation based on whether a type is a
-     * map-like container.
-     */
-    RETROLIB_EXPORT template <>
-    struct TIsMap<std::map> : std::true_type {};
-
     /**
      * @brief A utility struct that defines a template alias to create a type
      *        based on the range value type of a given range.
@@ -97,6 +75,28 @@ namespace Retro::Ranges {
         ;
     };
 
+    /**
+     * The number of elements that are read at a time when draining a batch readable range into a container.
+     */
+    constexpr std::size_t TO_BATCH_SIZE = 64;
+
+    /**
+     * The number of elements above which an ordered associative container is built by sorting the elements first,
+     * rather than inserting them one at a time.
+     */
+    constexpr std::size_t TO_SORTED_BUILD_MIN_SIZE = 4096;
+
+    /**
+     * Concept used for checking if the elements of a range can be appended to a container.
+     *
+     * @tparam C The type of container to append to
+     * @tparam R The type of range to convert
+     */
+    template <typename C, typename R>
+    concept CompatibleContainerType = std::ranges::input_range<R> &&
+                                      AppendableContainer<C, std::ranges::range_value_t<R>> &&
+                                      ContainerCompatibleRange<R, TRangeCommonReference<R>>;
+
     /**
      * Concept used for doing checks on a compatible container type.
      *
@@ -105,9 +105,217 @@ namespace Retro::Ranges {
      * @tparam A The constructor arguments for the container
      */
     template <typename C, typename R, typename... A>
-    concept CompatibleContainerTypeForArgs =
-        std::ranges::input_range<R> && AppendableContainer<C, std::ranges::range_value_t<R>> &&
-        ContainerCompatibleRange<R, TRangeCommonReference<R>> && std::constructible_from<C, A...>;
+    concept CompatibleContainerTypeForArgs = CompatibleContainerType<C, R> && std::constructible_from<C, A...>;
+
+    /**
+     * Concept for an ordered associative container, such as `std::map` or `std::set`, that accepts a hint for where a
+     * new element should be placed.
+     *
+     * @tparam C The type to check
+     */
+    template <typename C>
+    concept StlOrderedAssociative = requires(C &Container, typename C::value_type &&Value) {
+        typename C::key_type;
+        { Container.key_comp() } -> std::same_as<typename C::key_compare>;
+        Container.emplace_hint(Container.end(), std::move(Value));
+    };
+
+    namespace Detail {
+        /**
+         * The type used to buffer the elements of an ordered associative container while they are being sorted. The
+         * value type of a map has a const key, so the buffer stores a mutable pair instead.
+         *
+         * @tparam C The type of container
+         */
+        template <StlOrderedAssociative C>
+        struct TSortedBuildBuffer {
+            using FElement = typename C::key_type;
+
+            static constexpr const FElement &GetKey(const FElement &Element) {
+                return Element;
+            }
+        };
+
+        template <StlOrderedAssociative C>
+            requires requires { typename C::mapped_type; }
+        struct TSortedBuildBuffer<C> {
+            using FElement = std::pair<typename C::key_type, typename C::mapped_type>;
+
+            static constexpr const typename C::key_type &GetKey(const FElement &Element) {
+                return Element.first;
+            }
+        };
+
+        /**
+         * Concept for a range whose elements can be sorted ahead of time before being inserted into an ordered
+         * associative container.
+         *
+         * @tparam C The type of container
+         * @tparam R The type of range
+         */
+        template <typename C, typename R>
+        concept SortedBuildable =
+            StlOrderedAssociative<C> && std::movable<typename TSortedBuildBuffer<C>::FElement> &&
+            std::constructible_from<typename TSortedBuildBuffer<C>::FElement, TRangeCommonReference<R>>;
+
+        /**
+         * Inserts every element of the range into an ordered associative container by first gathering the elements
+         * into a buffer and sorting them, so that each insertion can be hinted to go at the end of the container,
+         * which takes amortized constant time instead of walking the tree. The sort is stable, so when several
+         * elements share a key the first one is kept, exactly as if they were inserted one at a time.
+         *
+         * @param Container The container to insert into
+         * @param Range The range of elements to insert
+         */
+        template <typename C, typename R>
+            requires SortedBuildable<C, R>
+        constexpr void BuildSorted(C &Container, R &&Range) {
+            using FBuffer = TSortedBuildBuffer<C>;
+            std::vector<typename FBuffer::FElement> Buffer;
+            if constexpr (std::ranges::sized_range<R>) {
+                Buffer.reserve(std::ranges::size(Range));
+            } else {
+                Buffer.reserve(Ranges::SizeHint(Range).GetReserveSize());
+            }
+
+            using RangeType = TRangeCommonReference<R>;
+            for (auto &&x : Range) {
+                Buffer.emplace_back(std::forward<RangeType>(x));
+            }
+
+            auto ByKey = [Compare = Container.key_comp()](const auto &Lhs, const auto &Rhs) {
+                return Compare(FBuffer::GetKey(Lhs), FBuffer::GetKey(Rhs));
+            };
+            // Input that is already ordered, such as an enumerated range, does not need to be sorted at all
+            if (!std::ranges::is_sorted(Buffer, ByKey)) {
+                std::ranges::stable_sort(Buffer, ByKey);
+            }
+
+            for (auto &Element : Buffer) {
+                Container.emplace_hint(Container.end(), std::move(Element));
+            }
+        }
+
+        /**
+         * Appends the elements of the range to the container one at a time, reading them in batches when the range
+         * supports it.
+         *
+         * @param Container The container to append to
+         * @param Range The range of elements to append
+         */
+        template <typename C, typename R>
+        constexpr void AppendEachElement(C &Container, R &&Range) {
+            if constexpr (BatchReadableRange<R> && std::default_initializable<std::ranges::range_value_t<R>>) {
+                std::array<std::ranges::range_value_t<R>, TO_BATCH_SIZE> Buffer;
+                auto Iterator = std::ranges::begin(Range);
+                std::size_t Count;
+                do {
+                    Count = Range.ReadBatch(Iterator, Buffer);
+                    for (std::size_t i = 0; i < Count; i++) {
+                        AppendContainer(Container, std::move(Buffer[i]));
+                    }
+                } while (Count == Buffer.size());
+            } else {
+                using RangeType = TRangeCommonReference<R>;
+                for (auto &&x : Range) {
+                    AppendContainer(Container, std::forward<RangeType>(x));
+                }
+            }
+        }
+
+        /**
+         * Appends every element of the range to the end of the container. If the container can be reserved, it is
+         * grown ahead of time to hold all the new elements: by the exact size of sized ranges, otherwise by the size
+         * hint of the range, preferring the upper bound when one is known. Growth is at least geometric so that
+         * repeatedly appending small ranges to the same container does not reallocate on every call.
+         *
+         * @param Container The container to append to
+         * @param Range The range of elements to append
+         */
+        template <typename C, typename R>
+            requires CompatibleContainerType<C, R>
+        constexpr void AppendElements(C &Container, R &&Range) {
+            if constexpr (ReservableContainer<C>) {
+                using FSize = std::ranges::range_size_t<C>;
+                auto Remaining = ContainerMaxSize(Container) - std::ranges::size(Container);
+                FSize Incoming;
+                if constexpr (std::ranges::sized_range<R>) {
+                    // We want to guarantee that we won't have any weird overflow issues when inserting into a
+                    // container with a mismatch between signed and unsigned sizes.
+                    RETROLIB_ASSERT(std::ranges::size(Range) <= static_cast<std::ranges::range_size_t<R>>(Remaining));
+                    Incoming = static_cast<FSize>(std::ranges::size(Range));
+                } else {
+                    // A hint is only an estimate, so clamp it to what the container could ever hold
+                    Incoming = static_cast<FSize>(
+                        std::min(Ranges::SizeHint(Range).GetReserveSize(), static_cast<size_t>(Remaining)));
+                }
+
+                auto Required = static_cast<FSize>(std::ranges::size(Container) + Incoming);
+                if (auto Capacity = ContainerCapacity(Container); Required > Capacity) {
+                    ContainerReserve(Container, std::max(Required, static_cast<FSize>(Capacity * 2)));
+                }
+            }
+
+            if constexpr (SegmentedRange<R>) {
+                // The container has already been reserved for the whole range, so each segment can take whichever
+                // path suits it best, such as a bulk copy for a contiguous segment
+                Ranges::ForEachSegment(Range, [&Container]<typename S>(S &Segment) {
+                    if constexpr (RangeAppendableContainer<C, S &>) {
+                        AppendRangeToContainer(Container, Segment);
+                    } else if constexpr (CompatibleContainerType<C, S &>) {
+                        AppendElements(Container, Segment);
+                    } else {
+                        for (auto &&x : Segment) {
+                            AppendContainer(Container, std::forward<decltype(x)>(x));
+                        }
+                    }
+                    return true;
+                });
+            } else if constexpr (RangeAppendableContainer<C, R>) {
+                AppendRangeToContainer(Container, std::forward<R>(Range));
+            } else if constexpr (SortedBuildable<C, R>) {
+                // Sorting only pays for itself once the tree is too large for inserting into it to stay in cache
+                if (Ranges::SizeHint(Range).GetReserveSize() >= TO_SORTED_BUILD_MIN_SIZE) {
+                    BuildSorted(Container, std::forward<R>(Range));
+                } else {
+                    AppendEachElement(Container, std::forward<R>(Range));
+                }
+            } else {
+                AppendEachElement(Container, std::forward<R>(Range));
+            }
+        }
+
+        /**
+         * Checks if a range reads its elements out of the given container. This recognizes the container itself, a
+         * contiguous range that overlaps its storage, and any view whose chain of base() calls leads back to one of
+         * those. Other ways of referring to the container, such as through a type-erased view, are not detected.
+         *
+         * @param Container The container that might be read from
+         * @param Range The range to check
+         * @return Whether the range was found to read from the container
+         */
+        template <typename C, typename R>
+        constexpr bool ReadsFromContainer(const C &Container, const R &Range) {
+            if constexpr (std::same_as<R, C>) {
+                return std::addressof(Range) == std::addressof(Container);
+            } else if constexpr (std::ranges::contiguous_range<const C> && std::ranges::contiguous_range<const R>) {
+                // Unrelated pointers can't be ordered during constant evaluation, where aliasing would be an error anyway
+                if (std::is_constant_evaluated()) {
+                    return false;
+                }
+
+                std::less<const volatile void *> Less;
+                auto ContainerData = std::ranges::data(Container);
+                auto RangeData = std::ranges::data(Range);
+                return Less(RangeData, ContainerData + std::ranges::size(Container)) &&
+                       Less(ContainerData, RangeData + std::ranges::size(Range));
+            } else if constexpr (requires { Range.base(); }) {
+                return ReadsFromContainer(Container, Range.base());
+            } else {
+                return false;
+            }
+        }
+    } // namespace Detail
 
     /**
      * Transforms the given range into a container of type C using provided arguments for construction.
@@ -115,7 +323,9 @@ namespace Retro::Ranges {
      * This function constructs a container of type C using the provided arguments. If the range is a sized
      * range and the container can be reserved, the function ensures that the container has sufficient capacity
      * to hold all elements in the range to prevent overflow issues. It then appends each element from the range
-     * into the container.
+     * into the container, using a single bulk operation when the range is contiguous or is a sized common range that
+     * the container can insert directly. Ordered associative containers are built by sorting the elements first, so
+     * that each one can be inserted at the end of the container.
      *
      * @tparam C The container type to create
      * @tparam R The type of the added range
@@ -128,19 +338,7 @@ namespace Retro::Ranges {
         requires(!std::ranges::view<C>) && CompatibleContainerTypeForArgs<C, R, A...>
     constexpr C To(R &&Range, A &&...Args) {
         C Result(std::forward<A>(Args)...);
-
-        if constexpr (std::ranges::sized_range<R> && ReservableContainer<C>) {
-            // We want to guarantee that we won't have any weird overflow issues when inserting into a container with
-            // a mismatch between signed and unsigned sizes.
-            RETROLIB_ASSERT(std::ranges::size(Range) <= static_cast<std::ranges::range_size_t<R>>(ContainerMaxSize(Result)));
-            ContainerReserve(Result, std::ranges::size(Range));
-        }
-
-        using RangeType = TRangeCommonReference<R>;
-        for (auto &&x : Range) {
-            AppendContainer(Result, std::forward<RangeType>(x));
-        }
-
+        Detail::AppendElements(Result, std::forward<R>(Range));
         return Result;
     }
 
@@ -289,4 +487,138 @@ namespace Retro::Ranges {
         return ExtensionMethod<TemplateToCallback<C>>(std::forward<A>(Args)...);
     }
 
+    /**
+     * Appends every element of the range to the end of an existing container. This allows a container to be kept
+     * alive and reused, instead of constructing a new one every time a range is materialized.
+     *
+     * @tparam C The type of container to append to
+     * @tparam R The type of the range
+     * @param Range The range of elements to append
+     * @param Container The container to append to
+     * @return A reference to the container
+     */
+    RETROLIB_EXPORT template <std::ranges::input_range R, typename C>
+        requires(!std::ranges::view<C>) && CompatibleContainerType<C, R>
+    constexpr C &AppendTo(R &&Range, C &Container) {
+        Detail::AppendElements(Container, std::forward<R>(Range));
+        return Container;
+    }
+
+    /**
+     * Replaces the contents of an existing container with the elements of the range. The container is cleared first,
+     * which for most containers keeps the storage it has already allocated, so reusing the same container across
+     * calls does not allocate once it has grown to the size of the largest range.
+     *
+     * Because the container is cleared before the range is read, a range that reads from the container itself, such
+     * as a filtered view of it, is first copied into a temporary buffer. Only the container itself, contiguous views
+     * of its storage and adaptors that expose them through base() are detected. Any other range must not refer to the
+     * elements of the container.
+     *
+     * @tparam C The type of container to assign to
+     * @tparam R The type of the range
+     * @param Range The range of elements to assign
+     * @param Container The container to assign to
+     * @return A reference to the container
+     */
+    RETROLIB_EXPORT template <std::ranges::input_range R, typename C>
+        requires(!std::ranges::view<C>) && ClearableContainer<C> && CompatibleContainerType<C, R>
+    constexpr C &AssignTo(R &&Range, C &Container) {
+        if (Detail::ReadsFromContainer(Container, Range)) {
+            auto Elements = To<std::vector<std::ranges::range_value_t<R>>>(std::forward<R>(Range));
+            ContainerClear(Container);
+            Detail::AppendElements(Container, std::ranges::subrange(std::make_move_iterator(Elements.begin()),
+                                                                    std::make_move_iterator(Elements.end())));
+        } else {
+            ContainerClear(Container);
+            Detail::AppendElements(Container, std::forward<R>(Range));
+        }
+        return Container;
+    }
+
+    /**
+     * @struct FAppendToInvoker
+     *
+     * @brief A function object that appends the elements of a range to an existing container.
+     *
+     * This struct is used to implement the pipe form of AppendTo, where the container is held by reference.
+     */
+    struct FAppendToInvoker {
+        /**
+         * Appends every element of the range to the end of the referenced container.
+         *
+         * @tparam R The type of the range
+         * @tparam C The type of container to append to
+         * @param Range The range of elements to append
+         * @param Container A reference to the container to append to
+         * @return A reference to the container
+         */
+        template <std::ranges::input_range R, typename C>
+            requires(!std::ranges::view<C>) && CompatibleContainerType<C, R>
+        constexpr C &operator()(R &&Range, std::reference_wrapper<C> Container) const {
+            return AppendTo(std::forward<R>(Range), Container.get());
+        }
+    };
+
+    /**
+     * @brief A constant expression instance of the FAppendToInvoker type.
+     */
+    constexpr FAppendToInvoker AppendToFunction;
+
+    /**
+     * @struct FAssignToInvoker
+     *
+     * @brief A function object that replaces the contents of an existing container with the elements of a range.
+     *
+     * This struct is used to implement the pipe form of AssignTo, where the container is held by reference.
+     */
+    struct FAssignToInvoker {
+        /**
+         * Replaces the contents of the referenced container with the elements of the range.
+         *
+         * @tparam R The type of the range
+         * @tparam C The type of container to assign to
+         * @param Range The range of elements to assign
+         * @param Container A reference to the container to assign to
+         * @return A reference to the container
+         */
+        template <std::ranges::input_range R, typename C>
+            requires(!std::ranges::view<C>) && ClearableContainer<C> && CompatibleContainerType<C, R>
+        constexpr C &operator()(R &&Range, std::reference_wrapper<C> Container) const {
+            return AssignTo(std::forward<R>(Range), Container.get());
+        }
+    };
+
+    /**
+     * @brief A constant expression instance of the FAssignToInvoker type.
+     */
+    constexpr FAssignToInvoker AssignToFunction;
+
+    /**
+     * Creates an extension method that appends the elements of a range to the given container. The container is
+     * captured by reference, so it must outlive the returned closure.
+     *
+     * @tparam C The type of container to append to
+     * @param Container The container to append to
+     * @return An extension method that can be applied to a range using the pipe operator.
+     */
+    RETROLIB_EXPORT template <typename C>
+        requires(!std::ranges::view<C>)
+    constexpr auto AppendTo(C &Container) {
+        return ExtensionMethod<AppendToFunction>(std::ref(Container));
+    }
+
+    /**
+     * Creates an extension method that replaces the contents of the given container with the elements of a range.
+     * The container is captured by reference, so it must outlive the returned closure.
+     *
+     * @tparam C The type of container to assign to
+     * @param Container The container to assign to
+     * @return An extension method that can be applied to a range using the pipe operator.
+     */
+    RETROLIB_EXPORT template <typename C>
+        requires(!std::ranges::view<C>) && ClearableContainer<C>
+    constexpr auto AssignTo(C &Container) {
+        return ExtensionMethod<AssignToFunction>(std::ref(Container));
+    }
+
 } // namespace retro::ranges
@@ -0,0 +1,186 @@
+/**
+ * @file ToArray.h
+ * @brief Functional chain components used for collecting a range into fixed capacity storage, including during
+ * constant evaluation.
+ *
+ * @author Retro & Chill
+ * https://github.com/retroandchill
+ */
+#pragma once
+
+#include "RetroLib/Functional/ExtensionMethods.h"
+#include "RetroLib/Ranges/Algorithm/To.h"
+#include "RetroLib/Ranges/FeatureBridge.h"
+#include "RetroLib/Utils/StaticVector.h"
+
+#if !RETROLIB_WITH_MODULES
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <ranges>
+#include <stdexcept>
+#include <utility>
+#endif
+
+#ifndef RETROLIB_EXPORT
+#define RETROLIB_EXPORT
+#endif
+
+namespace Retro::Ranges {
+    /**
+     * Concept for a range whose elements can be stored in fixed capacity storage that is default initialized ahead of
+     * time and then assigned to.
+     *
+     * @tparam R The type of the range
+     */
+    template <typename R>
+    concept FixedStorageCompatibleRange =
+        std::ranges::input_range<R> && std::default_initializable<std::ranges::range_value_t<R>> &&
+        std::assignable_from<std::ranges::range_value_t<R> &, TRangeCommonReference<R>>;
+
+    /**
+     * Collects a range into an array that holds exactly N elements. This can be evaluated as a constant expression, so
+     * a lookup table can be generated at compile time by the same range pipeline that would be used at runtime.
+     *
+     * @tparam N The number of elements in the array
+     * @tparam R The type of the range
+     * @param Range The range of elements to collect
+     * @return An array containing the elements of the range
+     * @throws std::length_error If the range does not contain exactly N elements. During constant evaluation this is
+     * reported as a compile error.
+     */
+    RETROLIB_EXPORT template <size_t N, FixedStorageCompatibleRange R>
+    constexpr std::array<std::ranges::range_value_t<R>, N> ToArray(R &&Range) {
+        if constexpr (std::ranges::sized_range<R>) {
+            if (static_cast<size_t>(std::ranges::size(Range)) != N) {
+                throw std::length_error("Range size does not match the size of the array");
+            }
+        }
+
+        std::array<std::ranges::range_value_t<R>, N> Result{};
+        size_t Count = 0;
+        using RangeType = TRangeCommonReference<R>;
+        for (auto &&x : Range) {
+            if (Count == N) {
+                throw std::length_error("Range has more elements than the array can hold");
+            }
+
+            Result[Count++] = std::forward<RangeType>(x);
+        }
+
+        if (Count != N) {
+            throw std::length_error("Range has fewer elements than the array can hold");
+        }
+
+        return Result;
+    }
+
+    /**
+     * Collects a range into a vector that can hold at most N elements and never allocates. This can be evaluated as a
+     * constant expression, which makes it suitable for generating a lookup table at compile time when the number of
+     * elements that will pass through a filter is not known ahead of time.
+     *
+     * @tparam N The maximum number of elements
+     * @tparam R The type of the range
+     * @param Range The range of elements to collect
+     * @return A static vector containing the elements of the range
+     * @throws std::length_error If the range has more than N elements. During constant evaluation this is reported as
+     * a compile error.
+     */
+    RETROLIB_EXPORT template <size_t N, FixedStorageCompatibleRange R>
+    constexpr TStaticVector<std::ranges::range_value_t<R>, N> ToStaticVector(R &&Range) {
+        if constexpr (std::ranges::sized_range<R>) {
+            if (static_cast<size_t>(std::ranges::size(Range)) > N) {
+                throw std::length_error("Range has more elements than the static vector can hold");
+            }
+        }
+
+        return To<TStaticVector<std::ranges::range_value_t<R>, N>>(std::forward<R>(Range));
+    }
+
+    /**
+     * @struct TToArrayInvoker
+     *
+     * @brief A function object that collects a range into an array of exactly N elements.
+     *
+     * This struct is used to implement the pipe form of ToArray.
+     *
+     * @tparam N The number of elements in the array
+     */
+    template <size_t N>
+    struct TToArrayInvoker {
+        /**
+         * Collects the range into an array of exactly N elements.
+         *
+         * @tparam R The type of the range
+         * @param Range The range of elements to collect
+         * @return An array containing the elements of the range
+         */
+        template <FixedStorageCompatibleRange R>
+        constexpr auto operator()(R &&Range) const {
+            return ToArray<N>(std::forward<R>(Range));
+        }
+    };
+
+    /**
+     * @brief A constant expression instance of the TToArrayInvoker type.
+     *
+     * @tparam N The number of elements in the array
+     */
+    template <size_t N>
+    constexpr TToArrayInvoker<N> ToArrayFunction;
+
+    /**
+     * @struct TToStaticVectorInvoker
+     *
+     * @brief A function object that collects a range into a static vector of at most N elements.
+     *
+     * This struct is used to implement the pipe form of ToStaticVector.
+     *
+     * @tparam N The maximum number of elements
+     */
+    template <size_t N>
+    struct TToStaticVectorInvoker {
+        /**
+         * Collects the range into a static vector of at most N elements.
+         *
+         * @tparam R The type of the range
+         * @param Range The range of elements to collect
+         * @return A static vector containing the elements of the range
+         */
+        template <FixedStorageCompatibleRange R>
+        constexpr auto operator()(R &&Range) const {
+            return ToStaticVector<N>(std::forward<R>(Range));
+        }
+    };
+
+    /**
+     * @brief A constant expression instance of the TToStaticVectorInvoker type.
+     *
+     * @tparam N The maximum number of elements
+     */
+    template <size_t N>
+    constexpr TToStaticVectorInvoker<N> ToStaticVectorFunction;
+
+    /**
+     * Creates an extension method that collects a range into an array of exactly N elements.
+     *
+     * @tparam N The number of elements in the array
+     * @return An extension method that can be applied to a range using the pipe operator.
+     */
+    RETROLIB_EXPORT template <size_t N>
+    constexpr auto ToArray() {
+        return ExtensionMethod<ToArrayFunction<N>>();
+    }
+
+    /**
+     * Creates an extension method that collects a range into a static vector of at most N elements.
+     *
+     * @tparam N The maximum number of elements
+     * @return An extension method that can be applied to a range using the pipe operator.
+     */
+    RETROLIB_EXPORT template <size_t N>
+    constexpr auto ToStaticVector() {
+        return ExtensionMethod<ToStaticVectorFunction<N>>();
+    }
+} // namespace retro::ranges
@@ -0,0 +1,297 @@
+/**
+ * @file TransformReduce.h
+ * @brief Functional chain component used for transforming and reducing a range down to a single value in one pass.
+ *
+ * @author Retro & Chill
+ * https://github.com/retroandchill
+ */
+#pragma once
+
+#include "RetroLib/Functional/CreateBinding.h"
+#include "RetroLib/Functional/ExtensionMethods.h"
+#include "RetroLib/Ranges/Algorithm/SimdReduce.h"
+#include "RetroLib/Ranges/FeatureBridge.h"
+#include "RetroLib/Ranges/Segments.h"
+
+#if !RETROLIB_WITH_MODULES
+#include <algorithm>
+#include <functional>
+#include <ranges>
+#include <type_traits>
+#endif
+
+#ifndef RETROLIB_EXPORT
+#define RETROLIB_EXPORT
+#endif
+
+namespace Retro::Ranges {
+    namespace Detail {
+        /**
+         * The number of transformed values that are buffered before they are handed to the vectorized kernel. Small
+         * enough for the buffer to stay in the L1 cache.
+         */
+        constexpr size_t TRANSFORM_REDUCE_BLOCK_SIZE = 256;
+
+        template <typename R, typename I, typename F, typename G>
+        concept VectorizedTransformReducible =
+            (RETROLIB_WITH_SIMD_REDUCE != 0) && std::ranges::contiguous_range<R> && std::ranges::sized_range<R> &&
+            SimdReduceElement<std::decay_t<I>> &&
+            std::same_as<std::invoke_result_t<G &, std::remove_reference_t<std::ranges::range_reference_t<R>> &>,
+                         std::decay_t<I>> &&
+            SimdReduceOp<std::remove_cvref_t<F>> != ESimdReduceOp::None &&
+            !(RETROLIB_WITH_STRICT_FLOAT_REDUCE && std::floating_point<std::decay_t<I>>);
+
+        template <typename R, typename I, typename F, typename G>
+        constexpr auto TransformReduceSequential(R &&Range, I &&Identity, F &ReduceFn, G &TransformFn) {
+            if constexpr (VectorizedTransformReducible<R, I, F, G>) {
+                if (!std::is_constant_evaluated()) {
+                    using FResult = std::decay_t<I>;
+                    constexpr auto Op = SimdReduceOp<std::remove_cvref_t<F>>;
+                    FResult Result = std::forward<I>(Identity);
+                    auto Data = std::ranges::data(Range);
+                    size_t Size = std::ranges::size(Range);
+                    FResult Buffer[TRANSFORM_REDUCE_BLOCK_SIZE];
+                    constexpr size_t BlockSize = TRANSFORM_REDUCE_BLOCK_SIZE;
+                    size_t Offset = 0;
+
+                    // Full blocks have a constant trip count, which lets the compiler vectorize the transform as well
+                    for (; Offset + BlockSize <= Size; Offset += BlockSize) {
+                        for (size_t i = 0; i < BlockSize; i++) {
+                            Buffer[i] = std::invoke(TransformFn, Data[Offset + i]);
+                        }
+                        Result = ReduceVectorized<Op>(Buffer, BlockSize, Result);
+                    }
+
+                    for (; Offset < Size; Offset++) {
+                        Result = std::invoke(ReduceFn, std::move(Result), std::invoke(TransformFn, Data[Offset]));
+                    }
+                    return Result;
+                }
+            }
+
+            auto Result = std::forward<I>(Identity);
+            if constexpr (SegmentedRange<R>) {
+                Ranges::ForEachSegment(Range, [&Result, &ReduceFn, &TransformFn](auto &Segment) {
+                    Result = TransformReduceSequential(Segment, std::move(Result), ReduceFn, TransformFn);
+                    return true;
+                });
+            } else {
+                for (auto &&Value : std::forward<R>(Range)) {
+                    Result = std::invoke(ReduceFn, std::move(Result),
+                                         std::invoke(TransformFn, std::forward<decltype(Value)>(Value)));
+                }
+            }
+            return Result;
+        }
+    } // namespace Detail
+
+    /**
+     * @brief Transforms each element of a range and reduces the transformed values into a single value, in one pass.
+     *
+     * This is equivalent to piping the range through Views::Transform into Reduce, but the transformation and the
+     * fold are performed in the same loop, without going through the iterators of a transformed view. The transform
+     * is invoked exactly once per element, in order, and the reduction functor is otherwise applied from left to right.
+     *
+     * When the range is contiguous, the transform produces an arithmetic value of the same type as the identity and
+     * the reduction functor is Add, Multiply, Min or Max, the transformed values are buffered in small blocks that are
+     * reduced by the same vectorized kernels as Reduce. Those kernels reassociate the fold, so floating point results
+     * may differ slightly from a left to right fold unless RETROLIB_WITH_STRICT_FLOAT_REDUCE is enabled.
+     *
+     * @tparam R The type of the range.
+     * @tparam I The type of the identity value.
+     * @tparam F The type of the reduction functor.
+     * @tparam G The type of the transform functor.
+     * @param Range The range of elements to be reduced.
+     * @param Identity The initial identity value used in the reduction process.
+     * @param ReduceFn A callable object that specifies how to combine the accumulated value with a transformed value.
+     * @param TransformFn A callable object that is applied to each element before it is reduced.
+     * @return The final aggregated result of the reduction operation.
+     */
+    RETROLIB_EXPORT template <std::ranges::input_range R, typename I, HasFunctionCallOperator F,
+                              HasFunctionCallOperator G>
+        requires std::invocable<G &, TRangeCommonReference<R>> &&
+                 std::invocable<F &, I, std::invoke_result_t<G &, TRangeCommonReference<R>>> &&
+                 std::convertible_to<std::invoke_result_t<F &, I, std::invoke_result_t<G &, TRangeCommonReference<R>>>,
+                                     I>
+    constexpr auto TransformReduce(R &&Range, I &&Identity, F ReduceFn, G TransformFn) {
+        return Detail::TransformReduceSequential(std::forward<R>(Range), std::forward<I>(Identity), ReduceFn,
+                                                 TransformFn);
+    }
+
+    /**
+     * Transforms and reduces a given range in one pass, using a transform created as a binding from the provided
+     * arguments.
+     *
+     * @param Range The range of elements to be reduced.
+     * @param Identity The identity value used for the reduction operation.
+     * @param ReduceFn A callable object that specifies how to combine the accumulated value with a transformed value.
+     * @param PrimeArg The primary argument to create a binding for the transform.
+     * @param Args Additional arguments to create a binding for the transform.
+     * @return The result of folding the transformed elements using the specified identity value.
+     */
+    RETROLIB_EXPORT template <std::ranges::input_range R, typename I, HasFunctionCallOperator F, typename T,
+                              typename... A>
+        requires std::invocable<TBindingType<T, A...> &, TRangeCommonReference<R>> &&
+                 std::invocable<F &, I, std::invoke_result_t<TBindingType<T, A...> &, TRangeCommonReference<R>>> &&
+                 std::convertible_to<
+                     std::invoke_result_t<F &, I,
+                                          std::invoke_result_t<TBindingType<T, A...> &, TRangeCommonReference<R>>>,
+                     I>
+    constexpr auto TransformReduce(R &&Range, I &&Identity, F ReduceFn, T &&PrimeArg, A &&...Args) {
+        return TransformReduce(std::forward<R>(Range), std::forward<I>(Identity), std::move(ReduceFn),
+                               CreateBinding(std::forward<T>(PrimeArg), std::forward<A>(Args)...));
+    }
+
+    /**
+     * Transforms and reduces the provided range in one pass, using compile-time functors for both the reduction and
+     * the transform. The additional arguments are bound to the transform.
+     *
+     * @tparam ReduceFunctor The functor used to combine the accumulated value with a transformed value.
+     * @tparam TransformFunctor The functor applied to each element before it is reduced.
+     * @tparam R The type of the range to reduce.
+     * @tparam I The type of the identity value.
+     * @tparam A The types of additional arguments required for creating a binding for the transform.
+     * @param Range The range of elements to process with reduction.
+     * @param Identity The initial value for the reduction operation.
+     * @param Args Additional arguments for creating the binding for the transform.
+     * @return The result of reducing the transformed range using the identity value.
+     */
+    RETROLIB_EXPORT template <auto ReduceFunctor, auto TransformFunctor, std::ranges::input_range R, typename I,
+                              typename... A>
+        requires HasFunctionCallOperator<decltype(ReduceFunctor)> &&
+                 HasFunctionCallOperator<decltype(TransformFunctor)> &&
+                 std::invocable<TConstBindingType<TransformFunctor, A...> &, TRangeCommonReference<R>> &&
+                 std::invocable<TConstBindingType<ReduceFunctor> &, I,
+                                std::invoke_result_t<TConstBindingType<TransformFunctor, A...> &,
+                                                     TRangeCommonReference<R>>> &&
+                 std::convertible_to<
+                     std::invoke_result_t<TConstBindingType<ReduceFunctor> &, I,
+                                          std::invoke_result_t<TConstBindingType<TransformFunctor, A...> &,
+                                                               TRangeCommonReference<R>>>,
+                     I>
+    constexpr auto TransformReduce(R &&Range, I &&Identity, A &&...Args) {
+        return TransformReduce(std::forward<R>(Range), std::forward<I>(Identity), CreateBinding<ReduceFunctor>(),
+                               CreateBinding<TransformFunctor>(std::forward<A>(Args)...));
+    }
+
+    /**
+     * @struct FTransformReduceInvoker
+     *
+     * @brief A function object that performs a fused transform and reduction over a range.
+     *
+     * This struct provides a callable interface to perform the `TransformReduce` operation on a range, and is used to
+     * implement the pipe form of `TransformReduce`.
+     */
+    struct FTransformReduceInvoker {
+        /**
+         * @brief Invokes the `TransformReduce` operation on a given range.
+         *
+         * @tparam R The type representing the input range, which must satisfy `std::ranges::input_range`.
+         * @tparam I The type of the identity element used in the reduction.
+         * @tparam A Variadic template for the reduction functor and the arguments used to create the transform.
+         *
+         * @param Range The input range over which the operation will be applied.
+         * @param Identity The identity element used for the reduction.
+         * @param Args The reduction functor, followed by the arguments used to create the transform.
+         *
+         * @return The result of the `TransformReduce` operation.
+         */
+        template <std::ranges::input_range R, typename I, typename... A>
+            requires requires(R &&Range, I &&Identity, A &&...Args) {
+                Ranges::TransformReduce(std::forward<R>(Range), std::forward<I>(Identity), std::forward<A>(Args)...);
+            }
+        constexpr auto operator()(R &&Range, I &&Identity, A &&...Args) const {
+            // Qualified so that argument-dependent lookup cannot find the pipe factory declared below, which would
+            // make the constraint depend on itself for ranges declared in this namespace
+            return Ranges::TransformReduce(std::forward<R>(Range), std::forward<I>(Identity),
+                                           std::forward<A>(Args)...);
+        }
+    };
+
+    /**
+     * @brief A constant expression instance of the FTransformReduceInvoker type.
+     */
+    constexpr FTransformReduceInvoker TransformReduceFunction;
+
+    /**
+     * @struct TTransformReduceConstInvoker
+     *
+     * @brief A function object that performs a fused transform and reduction over a range using compile-time
+     * functors.
+     *
+     * @tparam ReduceFunctor The functor used to combine the accumulated value with a transformed value.
+     * @tparam TransformFunctor The functor applied to each element before it is reduced.
+     */
+    template <auto ReduceFunctor, auto TransformFunctor>
+        requires HasFunctionCallOperator<decltype(ReduceFunctor)> &&
+                 HasFunctionCallOperator<decltype(TransformFunctor)>
+    struct TTransformReduceConstInvoker {
+        /**
+         * @brief Invokes the `TransformReduce` operation on a provided input range.
+         *
+         * @tparam R The type of the input range; must satisfy `std::ranges::input_range`.
+         * @tparam I The type of the identity element.
+         * @tparam A Variadic types for additional arguments bound to the transform.
+         *
+         * @param Range The input range on which the operation is applied.
+         * @param Identity The identity element used as the initial value for the reduction.
+         * @param Args Additional arguments bound to the transform.
+         *
+         * @return The result of the `TransformReduce` operation.
+         */
+        template <std::ranges::input_range R, typename I, typename... A>
+            requires requires(R &&Range, I &&Identity, A &&...Args) {
+                Ranges::TransformReduce<ReduceFunctor, TransformFunctor>(std::forward<R>(Range),
+                                                                         std::forward<I>(Identity),
+                                                                         std::forward<A>(Args)...);
+            }
+        constexpr auto operator()(R &&Range, I &&Identity, A &&...Args) const {
+            return Ranges::TransformReduce<ReduceFunctor, TransformFunctor>(
+                std::forward<R>(Range), std::forward<I>(Identity), std::forward<A>(Args)...);
+        }
+    };
+
+    /**
+     * @brief A constexpr instance of TTransformReduceConstInvoker for the given functors.
+     *
+     * @tparam ReduceFunctor The functor used to combine the accumulated value with a transformed value.
+     * @tparam TransformFunctor The functor applied to each element before it is reduced.
+     */
+    template <auto ReduceFunctor, auto TransformFunctor>
+        requires HasFunctionCallOperator<decltype(ReduceFunctor)> &&
+                 HasFunctionCallOperator<decltype(TransformFunctor)>
+    constexpr TTransformReduceConstInvoker<ReduceFunctor, TransformFunctor> TransformReduceConstFunction;
+
+    /**
+     * Creates an extension method that transforms and reduces a range in one pass.
+     *
+     * @tparam I The type of the identity value.
+     * @tparam A The types of the reduction functor and the arguments used to create the transform.
+     * @param Identity The initial value for the reduction.
+     * @param Args The reduction functor, followed by the arguments used to create the transform.
+     * @return An extension method that can be applied to a range using the pipe operator.
+     */
+    RETROLIB_EXPORT template <typename I, typename... A>
+    constexpr auto TransformReduce(I &&Identity, A &&...Args) {
+        return ExtensionMethod<TransformReduceFunction>(std::forward<I>(Identity), std::forward<A>(Args)...);
+    }
+
+    /**
+     * Creates an extension method that transforms and reduces a range in one pass, using compile-time functors.
+     *
+     * @tparam ReduceFunctor The functor used to combine the accumulated value with a transformed value.
+     * @tparam TransformFunctor The functor applied to each element before it is reduced.
+     * @tparam I The type of the identity value.
+     * @tparam A The types of the arguments bound to the transform.
+     * @param Identity The initial value for the reduction.
+     * @param Args Additional arguments bound to the transform.
+     * @return An extension method that can be applied to a range using the pipe operator.
+     */
+    RETROLIB_EXPORT template <auto ReduceFunctor, auto TransformFunctor, typename I, typename... A>
+        requires HasFunctionCallOperator<decltype(ReduceFunctor)> &&
+                 HasFunctionCallOperator<decltype(TransformFunctor)>
+    constexpr auto TransformReduce(I &&Identity, A &&...Args) {
+        return ExtensionMethod<TransformReduceConstFunction<ReduceFunctor, TransformFunctor>>(
+            std::forward<I>(Identity), std::forward<A>(Args)...);
+    }
+} // namespace retro::ranges
@@ -34,6 +34,9 @@ namespace Retro::Ranges {
     template <typename C, typename T>
     concept UnrealAppendable = UnrealEmplace<C, T> || UnrealAdd<C, T> || UnrealInsert<C, T> || UnrealAddable<C, T>;
 
+    template <typename C, typename T>
+    concept UnrealAppendPointer = requires(C &Container, const T *Ptr, int32 Count) { Container.Append(Ptr, Count); };
+
     template <typename C>
     concept UnrealSizedContainer = requires(C &Container) {
         { Container.Num() } -> std::convertible_to<int32>;
@@ -58,6 +61,9 @@ namespace Retro::Ranges {
             Container.GetAllocatedSize();
         };
 
+    template <typename T>
+    concept UnrealClearable = (!StlClearable<T>) && requires(T &Container) { Container.Reset(); };
+
     template <>
     struct TIsMap<TMap> : std::true_type {};
 } // namespace Retro::Ranges
@@ -111,6 +117,25 @@ namespace Retro::Ranges {
         }
     };
 
+    template <typename C>
+        requires UnrealAppendPointer<C, std::ranges::range_value_t<C>>
+    struct TRangeAppendableContainerType<C> : FValidType {
+        template <typename R>
+            requires std::ranges::contiguous_range<R> && std::ranges::sized_range<R> &&
+                     std::same_as<std::ranges::range_value_t<R>, std::ranges::range_value_t<C>>
+        static constexpr void AppendRange(C &Container, R &&Range) {
+            Container.Append(std::ranges::data(Range), static_cast<int32>(std::ranges::size(Range)));
+        }
+    };
+
+    RETROLIB_EXPORT template <UnrealClearable T>
+    struct TClearableContainerType<T> : FValidType {
+        static constexpr void Clear(T &Container) {
+            // Reset keeps the allocation around, unlike Empty
+            Container.Reset();
+        }
+    };
+
     RETROLIB_EXPORT template <UnrealReservable T>
     struct TReservableContainerType<T> : FValidType {
         static constexpr void Reserve(T &Container, int32 Size) {
@@ -11,7 +11,10 @@
 #include "RetroLib/TypeTraits.h"
 
 #if !RETROLIB_WITH_MODULES
+#include <cstddef>
+#include <map>
 #include <ranges>
+#include <span>
 #endif
 
 #ifndef RETROLIB_EXPORT
@@ -158,6 +161,58 @@ namespace Retro::Ranges {
         return TReservableContainerType<std::decay_t<T>>::MaxSize(Range);
     }
 
+    /**
+     * Concept that defines if a container has an STL style clear method.
+     *
+     * @tparam T The type to check
+     */
+    template <typename T>
+    concept StlClearable = requires(T &Container) { Container.clear(); };
+
+    /**
+     * Represents a container type that can have all of its elements removed.
+     */
+    RETROLIB_EXPORT template <typename>
+    struct TClearableContainerType : FInvalidType {};
+
+    /**
+     * Provides a type trait capable of removing all elements from an STL style container.
+     *
+     * @tparam T The type of the container
+     */
+    RETROLIB_EXPORT template <StlClearable T>
+    struct TClearableContainerType<T> : FValidType {
+        /**
+         * Removes all elements from the container. For the standard sequence containers this leaves the capacity of
+         * the container unchanged.
+         *
+         * @param Container The container to clear
+         */
+        static constexpr void Clear(T &Container) {
+            Container.clear();
+        }
+    };
+
+    /**
+     * Concept that checks if all the elements of a container can be removed.
+     *
+     * @tparam T The type to check
+     */
+    RETROLIB_EXPORT template <typename T>
+    concept ClearableContainer = TClearableContainerType<std::decay_t<T>>::IsValid &&
+                                 requires(T &Container) { TClearableContainerType<std::decay_t<T>>::Clear(Container); };
+
+    /**
+     * Removes all elements from the given container, keeping its allocated storage where the container allows it.
+     *
+     * @tparam T The type of container
+     * @param Container The container to clear
+     */
+    RETROLIB_EXPORT template <ClearableContainer T>
+    constexpr void ContainerClear(T &Container) {
+        TClearableContainerType<std::decay_t<T>>::Clear(Container);
+    }
+
     /**
      * Concept that defines if a container has an STL style emplace_back method.
      *
@@ -298,6 +353,130 @@ namespace Retro::Ranges {
         return TAppendableContainerType<C>::Append(Container, std::forward<T>(Value));
     }
 
+    /**
+     * Concept that defines if a container has a C++23 style append_range method.
+     *
+     * @tparam C The type to check
+     * @tparam R The type of range to append
+     */
+    template <typename C, typename R>
+    concept StlAppendRange = requires(C &Container, R &&Range) { Container.append_range(std::forward<R>(Range)); };
+
+    /**
+     * Concept that defines if a container has an STL style insert method that takes a pair of iterators.
+     *
+     * @tparam C The type to check
+     * @tparam I The type of iterator to insert from
+     */
+    template <typename C, typename I>
+    concept StlInsertIteratorPair =
+        requires(C &Container, I First, I Last) { Container.insert(Container.end(), First, Last); };
+
+    /**
+     * Concept that defines if a container has an STL style append method that takes a pointer to its own element type
+     * and a count, such as the one on `std::basic_string`. Unlike inserting a pair of iterators, this never needs to
+     * build a temporary copy of the input.
+     *
+     * @tparam C The type to check
+     * @tparam P The type of pointer to append from
+     */
+    template <typename C, typename P>
+    concept StlAppendPointerAndCount =
+        std::is_pointer_v<P> &&
+        std::same_as<std::remove_cv_t<std::remove_pointer_t<P>>, std::ranges::range_value_t<C>> &&
+        requires(C &Container, P Data, std::ranges::range_size_t<C> Count) { Container.append(Data, Count); };
+
+    /**
+     * Concept that defines if a range stores its elements contiguously in a way that an STL style container can insert
+     * them as a pair of pointers.
+     *
+     * @tparam C The type to check
+     * @tparam R The type of range to append
+     */
+    template <typename C, typename R>
+    concept StlContiguousAppendable =
+        std::ranges::contiguous_range<R> && std::ranges::sized_range<R> &&
+        StlInsertIteratorPair<C, decltype(std::ranges::data(std::declval<R &>()))>;
+
+    /**
+     * Concept that defines if a range can be appended by an STL style container in a single operation, either because
+     * its elements are stored contiguously, or because it is a sized common range whose iterators the container's
+     * insert method accepts.
+     *
+     * @tparam C The type to check
+     * @tparam R The type of range to append
+     */
+    template <typename C, typename R>
+    concept StlBulkAppendable =
+        std::convertible_to<std::ranges::range_reference_t<R>, std::ranges::range_value_t<C>> &&
+        (StlContiguousAppendable<C, R> || StlAppendRange<C, R> ||
+         (std::ranges::sized_range<R> && std::ranges::common_range<R> &&
+          StlInsertIteratorPair<C, std::ranges::iterator_t<R>>));
+
+    /**
+     * Represents a container type that supports appending an entire range in a single operation.
+     */
+    RETROLIB_EXPORT template <typename>
+    struct TRangeAppendableContainerType : FInvalidType {};
+
+    /**
+     * Provides a type trait capable of appending a whole range to a container in a single bulk operation, instead of
+     * appending each element individually. Contiguous ranges are passed to the container as a pair of pointers, which
+     * standard containers turn into a single memcpy for trivially copyable elements. Strings are given a pointer and
+     * a count instead, as inserting a pair of iterators into them can copy the input into a temporary string first.
+     *
+     * @tparam C The container type to which the append functionality is being applied.
+     */
+    RETROLIB_EXPORT template <typename C>
+        requires std::ranges::range<C> && StlInsertIteratorPair<C, const std::ranges::range_value_t<C> *>
+    struct TRangeAppendableContainerType<C> : FValidType {
+        /**
+         * Appends every element of the range to the end of the container.
+         *
+         * @param Container The container to append to
+         * @param Range The range of elements to append
+         */
+        template <typename R>
+            requires StlBulkAppendable<C, R>
+        static constexpr void AppendRange(C &Container, R &&Range) {
+            if constexpr (StlContiguousAppendable<C, R>) {
+                auto Data = std::ranges::data(Range);
+                if constexpr (StlAppendPointerAndCount<C, decltype(Data)>) {
+                    Container.append(Data, static_cast<std::ranges::range_size_t<C>>(std::ranges::size(Range)));
+                } else {
+                    Container.insert(Container.end(), Data, Data + std::ranges::size(Range));
+                }
+            } else if constexpr (StlAppendRange<C, R>) {
+                Container.append_range(std::forward<R>(Range));
+            } else {
+                Container.insert(Container.end(), std::ranges::begin(Range), std::ranges::end(Range));
+            }
+        }
+    };
+
+    /**
+     * Concept that defines if a range can be appended to a container in a single bulk operation.
+     *
+     * @tparam C The type to check
+     * @tparam R The type of range to append
+     */
+    template <typename C, typename R>
+    concept RangeAppendableContainer = TRangeAppendableContainerType<C>::IsValid && requires(C &Container, R &&Range) {
+        TRangeAppendableContainerType<C>::AppendRange(Container, std::forward<R>(Range));
+    };
+
+    /**
+     * Appends every element of a range to the given container in a single bulk operation.
+     *
+     * @param Container The container to append to
+     * @param Range The range of elements to append
+     */
+    template <typename C, typename R>
+        requires RangeAppendableContainer<C, R>
+    constexpr void AppendRangeToContainer(C &Container, R &&Range) {
+        TRangeAppendableContainerType<C>::AppendRange(Container, std::forward<R>(Range));
+    }
+
     /**
      * Concept that defines if a range has a compatible element type.
      *
@@ -306,4 +485,49 @@ namespace Retro::Ranges {
      */
     template <typename R, typename T>
     concept ContainerCompatibleRange = std::ranges::input_range<R> && std::convertible_to<TRangeCommonReference<R>, T>;
+
+    /**
+     * Concept that defines if a range can copy out several elements at once into a caller provided buffer. This is
+     * used by type-erased ranges so that draining them costs a single dispatch per batch instead of several per
+     * element.
+     *
+     * @tparam R The type to check
+     */
+    RETROLIB_EXPORT template <typename R>
+    concept BatchReadableRange =
+        std::ranges::input_range<R> &&
+        requires(R &Range, std::ranges::iterator_t<R> &Iterator, std::span<std::ranges::range_value_t<R>> Buffer) {
+            { Range.ReadBatch(Iterator, Buffer) } -> std::same_as<std::size_t>;
+        };
+
+    /**
+     * @struct TIsMap
+     * @brief A type trait structure that indicates whether a given type is a map.
+     *
+     * This struct is a specialization of `std::false_type` and represents a compile-time
+     * boolean constant. It will evaluate to `false` for any type unless explicitly
+     * specialized for map-like types.
+     *
+     * Use this structure to perform type-checking operations for map-like types
+     * in template metaprogramming scenarios.
+     */
+    RETROLIB_EXPORT template <template <typename...> typename>
+    struct TIsMap : std::false_type {};
+
+    /**
+     * @brief Trait to identify the std::map type.
+     *
+     * This specialization of the IsMap struct evaluates to std::true_type
+     * for the std::map type, indicating that the given type is considered
+     * a map-like container. It provides a convenient way to detect maps
+     * in template metaprogramming.
+     *
+     * @tparam std::map The specialization is explicitly defined for std::map.
+     *
+     * The primary use of this struct is to help with type identification
+     * and enable conditional compilation based on whether a type is a
+     * map-like container.
+     */
+    RETROLIB_EXPORT template <>
+    struct TIsMap<std::map> : std::true_type {};
 } // namespace retro::ranges
\ No newline at end of file
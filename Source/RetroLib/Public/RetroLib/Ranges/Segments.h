@@ -0,0 +1,71 @@
+/**
+ * @file Segments.h
+ * @brief Protocol for traversing a range that is made up of several underlying ranges one segment at a time.
+ *
+ * @author Retro & Chill
+ * https://github.com/retroandchill
+ */
+#pragma once
+
+#if !RETROLIB_WITH_MODULES
+#include <concepts>
+#include <functional>
+#include <ranges>
+#include <type_traits>
+#endif
+
+#ifndef RETROLIB_EXPORT
+#define RETROLIB_EXPORT
+#endif
+
+namespace Retro::Ranges {
+    /**
+     * @brief Concept for a range that is made up of several underlying ranges, and that can hand each of those ranges
+     * to a functor in order.
+     *
+     * The range must provide a ForEachSegment member function that invokes the functor once for each segment, passing
+     * the segment as an lvalue, and stops as soon as the functor returns false. The return value is true if every
+     * segment was visited. Algorithms use this to run a tight loop over each segment, which can be vectorized when the
+     * segment is contiguous, instead of going through the iterator of the combined range for every element.
+     *
+     * @tparam R The type to check
+     */
+    RETROLIB_EXPORT template <typename R>
+    concept SegmentedRange = std::ranges::input_range<R> && requires(R &Range) {
+        { Range.ForEachSegment([](auto &) { return true; }) } -> std::same_as<bool>;
+    };
+
+    /**
+     * @struct FForEachSegmentInvoker
+     *
+     * @brief Invokes a functor on each segment of a range.
+     *
+     * Segmented ranges are split into their segments, flattening any segments that are segmented themselves. Any other
+     * range is passed to the functor as a single segment.
+     */
+    struct FForEachSegmentInvoker {
+        /**
+         * Invokes a functor on each segment of a range, in order. The segments are always passed as lvalues, even if
+         * the range is an rvalue, as the range outlives the call.
+         *
+         * @tparam R The type of the range
+         * @tparam F The type of the functor
+         * @param Range The range to split into segments
+         * @param Functor The functor to invoke, which returns false to stop visiting segments
+         * @return Were all the segments visited
+         */
+        template <std::ranges::input_range R, typename F>
+        constexpr bool operator()(R &&Range, F &&Functor) const {
+            if constexpr (SegmentedRange<std::remove_reference_t<R>>) {
+                return Range.ForEachSegment(std::forward<F>(Functor));
+            } else {
+                return static_cast<bool>(std::invoke(Functor, Range));
+            }
+        }
+    };
+
+    /**
+     * Invokes a functor on each segment of a range, in order, stopping early if the functor returns false.
+     */
+    RETROLIB_EXPORT constexpr FForEachSegmentInvoker ForEachSegment;
+} // namespace retro::ranges
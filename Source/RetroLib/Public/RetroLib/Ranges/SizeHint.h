@@ -0,0 +1,200 @@
+/**
+ * @file SizeHint.h
+ * @brief Protocol for estimating the number of elements in a range that does not know its exact size.
+ *
+ * @author Retro & Chill
+ * https://github.com/retroandchill
+ */
+#pragma once
+
+#include "RetroLib/TypeTraits.h"
+
+#if !RETROLIB_WITH_MODULES
+#include <cstddef>
+#include <optional>
+#include <ranges>
+#endif
+
+#ifndef RETROLIB_EXPORT
+#define RETROLIB_EXPORT
+#endif
+
+namespace Retro::Ranges {
+    /**
+     * Bounds on the number of elements in a range.
+     */
+    RETROLIB_EXPORT struct FSizeHint {
+        /**
+         * The range is guaranteed to have at least this many elements.
+         */
+        size_t LowerBound = 0;
+
+        /**
+         * The range is guaranteed to have at most this many elements, if known.
+         */
+        std::optional<size_t> UpperBound;
+
+        /**
+         * Creates a hint for a range whose size is known exactly.
+         *
+         * @param Size The number of elements in the range
+         * @return The created hint
+         */
+        static constexpr FSizeHint Exact(size_t Size) noexcept {
+            return {Size, Size};
+        }
+
+        /**
+         * Gets the number of elements that a container should reserve to hold the range, which is the upper bound if
+         * it is known, otherwise the lower bound.
+         *
+         * @return The number of elements to reserve
+         */
+        constexpr size_t GetReserveSize() const noexcept {
+            return UpperBound.value_or(LowerBound);
+        }
+
+        /**
+         * Combines the hints of two ranges that are traversed one after the other.
+         *
+         * @param Lhs The hint of the first range
+         * @param Rhs The hint of the second range
+         * @return The hint of both ranges together
+         */
+        friend constexpr FSizeHint operator+(const FSizeHint &Lhs, const FSizeHint &Rhs) noexcept {
+            FSizeHint Result = {Lhs.LowerBound + Rhs.LowerBound, std::nullopt};
+            if (Lhs.UpperBound.has_value() && Rhs.UpperBound.has_value()) {
+                Result.UpperBound = *Lhs.UpperBound + *Rhs.UpperBound;
+            }
+            return Result;
+        }
+
+        /**
+         * Scales the hint of a range that is traversed the given number of times.
+         *
+         * @param Hint The hint of the range
+         * @param Count The number of times the range is traversed
+         * @return The hint of the repeated range
+         */
+        friend constexpr FSizeHint operator*(const FSizeHint &Hint, size_t Count) noexcept {
+            FSizeHint Result = {Hint.LowerBound * Count, std::nullopt};
+            if (Hint.UpperBound.has_value()) {
+                Result.UpperBound = *Hint.UpperBound * Count;
+            }
+            return Result;
+        }
+
+        constexpr bool operator==(const FSizeHint &) const = default;
+    };
+
+    /**
+     * Concept that defines if a range has a SizeHint member function.
+     *
+     * @tparam R The type to check
+     */
+    template <typename R>
+    concept HasSizeHintMember = requires(R &Range) {
+        { Range.SizeHint() } -> std::convertible_to<FSizeHint>;
+    };
+
+    /**
+     * Type trait that provides a size hint for range types that cannot be given a SizeHint member function, such as
+     * the adaptors of the standard library. Specializations must provide a static SizeHint method taking the range.
+     */
+    RETROLIB_EXPORT template <typename>
+    struct TSizeHintProvider : FInvalidType {};
+
+    /**
+     * @struct FSizeHintInvoker
+     *
+     * @brief Computes the bounds on the number of elements of a range.
+     *
+     * Sized ranges report their exact size. Otherwise the range is asked through its SizeHint member function, or
+     * through a specialization of TSizeHintProvider, and if neither is available the size is reported as unknown.
+     */
+    struct FSizeHintInvoker {
+        /**
+         * Computes the bounds on the number of elements of a range. The range may be const qualified even if it can
+         * only be iterated when it is mutable, as is the case for the base of a const view.
+         *
+         * @tparam R The type of the range
+         * @param Range The range to estimate the size of
+         * @return The bounds on the size of the range
+         */
+        template <typename R>
+        constexpr FSizeHint operator()(R &Range) const {
+            if constexpr (std::ranges::sized_range<R>) {
+                return FSizeHint::Exact(static_cast<size_t>(std::ranges::size(Range)));
+            } else if constexpr (HasSizeHintMember<R>) {
+                return Range.SizeHint();
+            } else if constexpr (TSizeHintProvider<std::remove_cv_t<R>>::IsValid) {
+                return TSizeHintProvider<std::remove_cv_t<R>>::SizeHint(Range);
+            } else {
+                return FSizeHint{};
+            }
+        }
+    };
+
+    /**
+     * Computes the bounds on the number of elements of a range, without traversing it where possible.
+     */
+    RETROLIB_EXPORT constexpr FSizeHintInvoker SizeHint;
+
+    /**
+     * Size hint for a reference to another range, which has the same size as the range it refers to.
+     */
+    template <typename R>
+    struct TSizeHintProvider<std::ranges::ref_view<R>> : FValidType {
+        static constexpr FSizeHint SizeHint(const std::ranges::ref_view<R> &Range) {
+            return Ranges::SizeHint(Range.base());
+        }
+    };
+
+    /**
+     * Size hint for a range owned by a view, which has the same size as the range it owns.
+     */
+    template <typename R>
+    struct TSizeHintProvider<std::ranges::owning_view<R>> : FValidType {
+        static constexpr FSizeHint SizeHint(const std::ranges::owning_view<R> &Range) {
+            return Ranges::SizeHint(Range.base());
+        }
+    };
+
+    /**
+     * Size hint for a transformed range, which has the same size as the range it transforms.
+     */
+    template <typename R, typename F>
+        requires std::copy_constructible<R>
+    struct TSizeHintProvider<std::ranges::transform_view<R, F>> : FValidType {
+        static constexpr FSizeHint SizeHint(const std::ranges::transform_view<R, F> &Range) {
+            auto Base = Range.base();
+            return Ranges::SizeHint(Base);
+        }
+    };
+
+    /**
+     * Size hint for a filtered range, which can have anywhere between none and all the elements of the range it
+     * filters.
+     */
+    template <typename R, typename F>
+        requires std::copy_constructible<R>
+    struct TSizeHintProvider<std::ranges::filter_view<R, F>> : FValidType {
+        static constexpr FSizeHint SizeHint(const std::ranges::filter_view<R, F> &Range) {
+            auto Base = Range.base();
+            return FSizeHint{0, Ranges::SizeHint(Base).UpperBound};
+        }
+    };
+
+    /**
+     * Size hint for a range that stops at the first element that fails a predicate, which can have anywhere between
+     * none and all the elements of the range it wraps.
+     */
+    template <typename R, typename F>
+        requires std::copy_constructible<R>
+    struct TSizeHintProvider<std::ranges::take_while_view<R, F>> : FValidType {
+        static constexpr FSizeHint SizeHint(const std::ranges::take_while_view<R, F> &Range) {
+            auto Base = Range.base();
+            return FSizeHint{0, Ranges::SizeHint(Base).UpperBound};
+        }
+    };
+} // namespace retro::ranges
@@ -4,7 +4,9 @@
 
 #include "RetroLib/Ranges/Views/AnyView.h"
 #include "RetroLib/Ranges/Views/CacheLast.h"
+#include "RetroLib/Ranges/Views/Chunk.h"
 #include "RetroLib/Ranges/Views/Concat.h"
+#include "RetroLib/Ranges/Views/ConcatAll.h"
 #include "RetroLib/Ranges/Views/Elements.h"
 #include "RetroLib/Ranges/Views/Enumerate.h"
 #include "RetroLib/Ranges/Views/Filter.h"
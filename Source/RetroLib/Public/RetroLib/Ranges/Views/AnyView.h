@@ -10,8 +10,13 @@
 #if !RETROLIB_WITH_MODULES
 #include "RetroLib/RetroLibMacros.h"
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <optional>
 #include <ranges>
+#include <span>
 #include <type_traits>
 #endif
 
@@ -37,6 +42,19 @@ namespace Retro::Ranges {
     template <typename R, typename T>
     concept CompatibleRange = std::convertible_to<std::ranges::range_reference_t<R>, T>;
 
+    /**
+     * @brief A concept to check if a range stores its elements of type T in a single block of memory.
+     *
+     * Ranges that satisfy this concept can be traversed by an erased view using a plain pointer walk, as the elements
+     * can be read directly out of the underlying storage without going through the type-erased iterator.
+     *
+     * @tparam R The range type to be checked.
+     * @tparam T The element type the range is being viewed as.
+     */
+    template <typename R, typename T>
+    concept ContiguousRangeOf = std::ranges::contiguous_range<R> && std::ranges::sized_range<R> &&
+                                std::same_as<std::ranges::range_value_t<R>, T>;
+
     /**
      * A templated structure that represents a runtime type information (RTTI) tag.
      *
@@ -234,7 +252,7 @@ namespace Retro::Ranges {
         }
 
       private:
-        template <typename>
+        template <typename, size_t, typename>
         friend class TAnyViewIterator;
 
         FErasedView *View = nullptr;
@@ -383,6 +401,15 @@ namespace Retro::Ranges {
             return FAnyRef(Iter);
         }
 
+        /**
+         * @brief Gets the underlying iterator being wrapped.
+         *
+         * @return A reference to the wrapped iterator.
+         */
+        I &GetBase() {
+            return Iter;
+        }
+
         T Read() const override {
             return *Iter;
         }
@@ -402,6 +429,9 @@ namespace Retro::Ranges {
         I Iter;
     };
 
+    template <typename T, size_t SmallStorageSize, typename Allocator>
+    class TAnyViewInterface;
+
     /**
      * @class TAnyViewIterator
      *
@@ -415,8 +445,11 @@ namespace Retro::Ranges {
      * to an implementation of the AnyViewIteratorInterface.
      *
      * @tparam T The type of elements that the iterator operates over.
+     * @tparam SmallStorageSize The size of the inline buffer used to store the erased iterator.
+     * @tparam Allocator The allocator used for erased iterators that do not fit in the inline buffer.
      */
-    RETROLIB_EXPORT template <typename T>
+    RETROLIB_EXPORT template <typename T, size_t SmallStorageSize = DEFAULT_SMALL_STORAGE_SIZE,
+                              typename Allocator = std::allocator<std::byte>>
     class TAnyViewIterator {
       public:
         using difference_type = std::ptrdiff_t;
@@ -449,6 +482,36 @@ namespace Retro::Ranges {
             : Delegate(std::in_place_type<TAnyViewIteratorImpl<std::decay_t<I>>>, std::forward<I>(Iterator)) {
         }
 
+        /**
+         * @brief Constructs an AnyViewIterator from an iterator with a known number of remaining elements.
+         *
+         * Reading and advancing still go through the erased iterator, but reaching the end is determined by counting
+         * down the remaining elements, so the end check never has to call back into the erased view.
+         *
+         * @tparam I The type of the input iterator.
+         *
+         * @param Iterator An iterator instance to initialize and adapt within this AnyViewIterator.
+         * @param Size The number of elements between the iterator and the end of the view.
+         */
+        template <typename I>
+            requires(!std::same_as<std::decay_t<I>, TAnyViewIterator>) && std::same_as<std::iter_value_t<I>, T>
+        constexpr TAnyViewIterator(I &&Iterator, std::ptrdiff_t Size)
+            : Delegate(std::in_place_type<TAnyViewIteratorImpl<std::decay_t<I>>>, std::forward<I>(Iterator)),
+              Remaining(Size), Traversal(ETraversal::Sized) {
+        }
+
+        /**
+         * @brief Constructs an AnyViewIterator that walks over a block of contiguous elements.
+         *
+         * None of the operations on an iterator constructed this way are dispatched through the erased iterator, so
+         * iteration costs the same as walking a pointer over the elements.
+         *
+         * @param Span The elements to iterate over.
+         */
+        constexpr explicit TAnyViewIterator(std::span<const T> Span) noexcept
+            : Current(Span.data()), Last(Span.data() + Span.size()), Traversal(ETraversal::Contiguous) {
+        }
+
         /**
          * @brief Compares two AnyViewIterator objects for equality.
          *
@@ -461,6 +524,10 @@ namespace Retro::Ranges {
          * @return true if both AnyViewIterator objects are equal, false otherwise.
          */
         constexpr bool operator==(const TAnyViewIterator &Other) const {
+            if (Traversal == ETraversal::Contiguous) {
+                return Current == Other.Current;
+            }
+
             return Delegate->Equal(*Other.Delegate);
         }
 
@@ -475,7 +542,14 @@ namespace Retro::Ranges {
          * @return true if the current iterator has reached the end of the view, false otherwise.
          */
         constexpr bool operator==(const FAnyViewSentinel &Other) const {
-            return Other.View->AtEnd(Delegate->Iterator());
+            switch (Traversal) {
+            case ETraversal::Contiguous:
+                return Current == Last;
+            case ETraversal::Sized:
+                return Remaining == 0;
+            default:
+                return Other.View->AtEnd(Delegate->Iterator());
+            }
         }
 
         /**
@@ -488,6 +562,10 @@ namespace Retro::Ranges {
          * @return The element of type T currently pointed to by the iterator.
          */
         constexpr T operator*() const {
+            if (Traversal == ETraversal::Contiguous) {
+                return *Current;
+            }
+
             return Delegate->Read();
         }
 
@@ -503,7 +581,19 @@ namespace Retro::Ranges {
          * @return A reference to the incremented AnyViewIterator instance.
          */
         constexpr TAnyViewIterator &operator++() {
-            Delegate->Next();
+            switch (Traversal) {
+            case ETraversal::Contiguous:
+                ++Current;
+                break;
+            case ETraversal::Sized:
+                Delegate->Next();
+                --Remaining;
+                break;
+            default:
+                Delegate->Next();
+                break;
+            }
+
             return *this;
         }
 
@@ -524,7 +614,71 @@ namespace Retro::Ranges {
         }
 
       private:
-        TPolymorphic<TAnyViewIteratorInterface<T>> Delegate = TAnyViewIteratorImpl<T *>(nullptr);
+        template <typename, size_t, typename>
+        friend class TAnyView;
+
+        std::size_t ReadBatch(TAnyViewInterface<T, SmallStorageSize, Allocator> &View, std::span<T> Buffer) {
+            switch (Traversal) {
+            case ETraversal::Contiguous: {
+                auto Count = std::min(Buffer.size(), static_cast<std::size_t>(Last - Current));
+                std::copy_n(Current, Count, Buffer.begin());
+                Current += Count;
+                return Count;
+            }
+            case ETraversal::Sized: {
+                auto Count = View.ReadBatch(
+                    *Delegate, Buffer.first(std::min(Buffer.size(), static_cast<std::size_t>(Remaining))));
+                Remaining -= static_cast<std::ptrdiff_t>(Count);
+                return Count;
+            }
+            default:
+                return View.ReadBatch(*Delegate, Buffer);
+            }
+        }
+
+        /**
+         * The strategy used to traverse the erased range, chosen when the view creates the iterator.
+         */
+        enum class ETraversal : std::uint8_t { Erased, Sized, Contiguous };
+
+        TPolymorphic<TAnyViewIteratorInterface<T>, SmallStorageSize, Allocator> Delegate =
+            TAnyViewIteratorImpl<T *>(nullptr);
+        const T *Current = nullptr;
+        const T *Last = nullptr;
+        std::ptrdiff_t Remaining = 0;
+        ETraversal Traversal = ETraversal::Erased;
+    };
+
+    /**
+     * @class TBatchReadableErasedView
+     *
+     * @brief Base of the erased view interface, which declares batch reads only when the elements can be assigned
+     * into a caller provided buffer.
+     *
+     * @tparam T The type of elements that the view will iterate over.
+     */
+    template <typename T>
+    class TBatchReadableErasedView : public FErasedView {
+      protected:
+        ~TBatchReadableErasedView() = default;
+    };
+
+    template <typename T>
+        requires std::assignable_from<T &, T>
+    class TBatchReadableErasedView<T> : public FErasedView {
+      protected:
+        ~TBatchReadableErasedView() = default;
+
+      public:
+        /**
+         * @brief Copies elements from the given position into the buffer, advancing the iterator past them.
+         *
+         * @param Iterator The erased iterator to read from, which must have been created by this view.
+         * @param Buffer The buffer to copy the elements into.
+         * @return The number of elements written, which is only less than the size of the buffer when the end of the
+         *         view has been reached.
+         */
+        virtual std::size_t ReadBatch(TAnyViewIteratorInterface<T> &Iterator, std::span<T> Buffer) = 0;
     };
 
     /**
@@ -540,6 +694,8 @@ namespace Retro::Ranges {
      * inherited from `ErasedView`.
      *
      * @tparam T The type of elements that the view will iterate over.
+     * @tparam SmallStorageSize The size of the inline buffer used to store the erased iterators.
+     * @tparam Allocator The allocator used for erased iterators that do not fit in the inline buffer.
      *
      * Key Responsibilities:
      * - Enforces the implementation of a `begin` method that provides an `AnyViewIterator` to start
@@ -547,8 +703,8 @@ namespace Retro::Ranges {
      * - Supports polymorphic iteration start-point specification. Derived classes need to define their
      *   own mechanism for retrieving the starting iterator.
      */
-    template <typename T>
-    class TAnyViewInterface : public FErasedView {
+    template <typename T, size_t SmallStorageSize, typename Allocator>
+    class TAnyViewInterface : public TBatchReadableErasedView<T> {
       public:
         /**
          * @brief Destructor for AnyViewInterface.
@@ -568,7 +724,38 @@ namespace Retro::Ranges {
          *
          * @return An iterator of type `AnyViewIterator<T>` referring to the start of the view.
          */
-        virtual TAnyViewIterator<T> begin() = 0;
+        virtual TAnyViewIterator<T, SmallStorageSize, Allocator> begin() = 0;
+
+        /**
+         * @brief Gets the elements of the view as a span, if the underlying range stores them contiguously.
+         *
+         * @return The elements of the view, or an empty optional if the underlying range is not contiguous.
+         */
+        virtual std::optional<std::span<const T>> TryGetSpan() = 0;
+    };
+
+    /**
+     * @class TBatchReadableAnyViewImpl
+     *
+     * @brief Base of the AnyView implementation, which overrides batch reads by forwarding them to the derived
+     * implementation when the interface declares them.
+     *
+     * @tparam D The derived implementation, which must provide ReadRangeBatch
+     * @tparam T The type of elements that the view will iterate over.
+     * @tparam SmallStorageSize The size of the inline buffer used to store the erased iterators.
+     * @tparam Allocator The allocator used for erased iterators that do not fit in the inline buffer.
+     */
+    template <typename D, typename T, size_t SmallStorageSize, typename Allocator>
+    class TBatchReadableAnyViewImpl : public TAnyViewInterface<T, SmallStorageSize, Allocator> {};
+
+    template <typename D, typename T, size_t SmallStorageSize, typename Allocator>
+        requires std::assignable_from<T &, T>
+    class TBatchReadableAnyViewImpl<D, T, SmallStorageSize, Allocator>
+        : public TAnyViewInterface<T, SmallStorageSize, Allocator> {
+      public:
+        std::size_t ReadBatch(TAnyViewIteratorInterface<T> &Iterator, std::span<T> Buffer) final {
+            return static_cast<D &>(*this).ReadRangeBatch(Iterator, Buffer);
+        }
     };
 
     /**
@@ -582,14 +769,21 @@ namespace Retro::Ranges {
      *
      * @tparam R The type of the range being viewed.
      * @tparam T The type of elements within the range. Defaults to the value type of the range.
+     * @tparam SmallStorageSize The size of the inline buffer used to store the erased iterators.
+     * @tparam Allocator The allocator used for erased iterators that do not fit in the inline buffer.
      *
      * This implementation:
      * - Provides a constructor that accepts a range and ensures type safety through constraints.
      * - Implements the `begin` function to return an AnyViewIterator over the beginning of the range.
      * - Implements the `atEnd` function to check if the iterator has reached the end of the range.
      */
-    template <typename R, typename T = std::ranges::range_value_t<R>>
-    class TAnyViewImpl : public TAnyViewInterface<T> {
+    template <typename R, typename T = std::ranges::range_value_t<R>,
+              size_t SmallStorageSize = DEFAULT_SMALL_STORAGE_SIZE, typename Allocator = std::allocator<std::byte>>
+    class TAnyViewImpl
+        : public TBatchReadableAnyViewImpl<TAnyViewImpl<R, T, SmallStorageSize, Allocator>, T, SmallStorageSize,
+                                           Allocator> {
+        using FIterator = TAnyViewIterator<T, SmallStorageSize, Allocator>;
+
       public:
         /**
          * @brief Constructs an AnyViewImpl object with the given range.
@@ -620,8 +814,42 @@ namespace Retro::Ranges {
          *
          * @return An `AnyViewIterator` object that points to the first element of the range.
          */
-        TAnyViewIterator<T> begin() override {
-            return TAnyViewIterator<T>(std::ranges::begin(Range));
+        FIterator begin() override {
+            if constexpr (ContiguousRangeOf<R, T>) {
+                return FIterator(std::span<const T>(std::ranges::data(Range), std::ranges::size(Range)));
+            } else if constexpr (std::ranges::sized_range<R>) {
+                return FIterator(std::ranges::begin(Range), std::ranges::distance(Range));
+            } else {
+                return FIterator(std::ranges::begin(Range));
+            }
+        }
+
+        std::optional<std::span<const T>> TryGetSpan() override {
+            if constexpr (ContiguousRangeOf<R, T>) {
+                return std::span<const T>(std::ranges::data(Range), std::ranges::size(Range));
+            } else {
+                return std::nullopt;
+            }
+        }
+
+        /**
+         * @brief Copies elements from the given position into the buffer, advancing the iterator past them.
+         *
+         * @param Iterator The erased iterator to read from, which must have been created by this view.
+         * @param Buffer The buffer to copy the elements into.
+         * @return The number of elements written, which is only less than the size of the buffer when the end of the
+         *         range has been reached.
+         */
+        std::size_t ReadRangeBatch(TAnyViewIteratorInterface<T> &Iterator, std::span<T> Buffer)
+            requires std::assignable_from<T &, T>
+        {
+            auto &It = static_cast<TAnyViewIteratorImpl<std::ranges::iterator_t<R>, T> &>(Iterator).GetBase();
+            auto End = std::ranges::end(Range);
+            std::size_t Count = 0;
+            for (; Count < Buffer.size() && It != End; ++It, ++Count) {
+                Buffer[Count] = *It;
+            }
+            return Count;
         }
 
         /**
@@ -659,6 +887,8 @@ namespace Retro::Ranges {
      * its integration into the C++ ranges framework.
      *
      * @tparam T The type of elements contained in the range this view will manage.
+     * @tparam SmallStorageSize The size of the inline buffers used to store the erased range and its iterators.
+     * @tparam Allocator The allocator used for erased ranges and iterators that do not fit in the inline buffers.
      *
      * The main functionalities provided by AnyView include:
      * - Construction from any range that is a valid input range, except from another AnyView.
@@ -671,10 +901,28 @@ namespace Retro::Ranges {
      * range types are accepted. Internally, it encapsulates the polymorphic behavior through
      * a `Polymorphic<AnyViewInterface<T>>` member, initializing with an empty view by default.
      */
-    RETROLIB_EXPORT template <typename T>
-    class TAnyView : public std::ranges::view_interface<TAnyView<T>> {
+    RETROLIB_EXPORT template <typename T, size_t SmallStorageSize = DEFAULT_SMALL_STORAGE_SIZE,
+                              typename Allocator = std::allocator<std::byte>>
+    class TAnyView : public std::ranges::view_interface<TAnyView<T, SmallStorageSize, Allocator>> {
+        template <typename R>
+        using TImpl = TAnyViewImpl<std::decay_t<R>, T, SmallStorageSize, Allocator>;
 
       public:
+        /**
+         * Checks if a range can be stored in an AnyView without allocating, either when the view is created or when
+         * iteration begins. Ranges that do not fit are allocated using the allocator instead.
+         *
+         * @tparam R The type of range to check
+         */
+        template <typename R>
+            requires std::ranges::input_range<R>
+        static constexpr bool FitsSmallStorage =
+            TPolymorphic<TAnyViewInterface<T, SmallStorageSize, Allocator>, SmallStorageSize,
+                         Allocator>::template FitsSmallStorage<TImpl<R>> &&
+            (ContiguousRangeOf<std::decay_t<R>, T> ||
+             TPolymorphic<TAnyViewIteratorInterface<T>, SmallStorageSize, Allocator>::template FitsSmallStorage<
+                 TAnyViewIteratorImpl<std::ranges::iterator_t<std::decay_t<R>>, T>>);
+
         /**
          * @brief Default constructor for AnyView.
          *
@@ -702,7 +950,7 @@ namespace Retro::Ranges {
         template <typename R>
             requires(!std::same_as<std::decay_t<R>, TAnyView>) && std::ranges::input_range<R> && CompatibleRange<R, T>
         explicit(false) TAnyView(R &&Range)
-            : Data(std::in_place_type<TAnyViewImpl<std::decay_t<R>>>, std::forward<R>(Range)) {
+            : Data(std::in_place_type<TImpl<R>>, std::forward<R>(Range)) {
         }
 
         /**
@@ -726,7 +974,7 @@ namespace Retro::Ranges {
         template <typename R>
             requires(!std::same_as<std::decay_t<R>, TAnyView>) && std::ranges::input_range<R>
         TAnyView &operator=(R &&Range) {
-            Data = TAnyViewImpl<std::decay_t<R>>(std::forward<R>(Range));
+            Data = TImpl<R>(std::forward<R>(Range));
             return *this;
         }
 
@@ -739,7 +987,7 @@ namespace Retro::Ranges {
          *
          * @return An `AnyViewIterator` instance pointing to the initial element of the range.
          */
-        TAnyViewIterator<T> begin() {
+        TAnyViewIterator<T, SmallStorageSize, Allocator> begin() {
             return Data->begin();
         }
 
@@ -756,7 +1004,37 @@ namespace Retro::Ranges {
             return FAnyViewSentinel(*Data);
         }
 
+        /**
+         * @brief Gets the elements of the view as a span, if the underlying range stores them contiguously.
+         *
+         * This allows consumers to bypass the erased iterator entirely and process the elements in bulk when the view
+         * wraps a container such as a `std::vector` or `std::array`.
+         *
+         * @return The elements of the view, or an empty optional if the underlying range is not contiguous.
+         */
+        std::optional<std::span<const T>> TryGetSpan() {
+            return Data->TryGetSpan();
+        }
+
+        /**
+         * @brief Reads up to the size of the buffer worth of elements from the given position in a single call.
+         *
+         * Iterating element by element goes through the type-erased iterator at each step, while this reads an entire
+         * batch with at most one dispatch, which makes it the preferred way to drain an AnyView into a container.
+         *
+         * @param Iterator An iterator obtained from this view, which is advanced past the elements that were read.
+         * @param Buffer The buffer to copy the elements into.
+         * @return The number of elements written, which is only less than the size of the buffer when the end of the
+         *         view has been reached.
+         */
+        std::size_t ReadBatch(TAnyViewIterator<T, SmallStorageSize, Allocator> &Iterator, std::span<T> Buffer)
+            requires std::assignable_from<T &, T>
+        {
+            return Iterator.ReadBatch(*Data, Buffer);
+        }
+
       private:
-        TPolymorphic<TAnyViewInterface<T>> Data = TAnyViewImpl<std::ranges::empty_view<T>>(std::views::empty<T>);
+        TPolymorphic<TAnyViewInterface<T, SmallStorageSize, Allocator>, SmallStorageSize, Allocator> Data =
+            TImpl<std::ranges::empty_view<T>>(std::views::empty<T>);
     };
 } // namespace retro::ranges
\ No newline at end of file
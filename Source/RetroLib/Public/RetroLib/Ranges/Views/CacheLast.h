@@ -9,6 +9,7 @@
 
 #include "RetroLib/Ranges/FeatureBridge.h"
 #include "RetroLib/Ranges/RangeBasics.h"
+#include "RetroLib/Ranges/SizeHint.h"
 #include "RetroLib/Utils/NonPropagatingCache.h"
 
 #ifndef RETROLIB_EXPORT
@@ -181,6 +182,15 @@ namespace Retro::Ranges {
             return std::ranges::size(Range);
         }
 
+        /**
+         * @brief Returns the bounds on the number of elements of the underlying range.
+         *
+         * @return The bounds on the number of elements in the view.
+         */
+        constexpr FSizeHint SizeHint() const {
+            return Retro::Ranges::SizeHint(Range);
+        }
+
       private:
         constexpr void Update(std::ranges::range_reference_t<R> &&value)
             requires std::assignable_from<std::ranges::range_value_t<R> &, std::ranges::range_value_t<R>>
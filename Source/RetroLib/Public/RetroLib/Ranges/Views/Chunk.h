@@ -0,0 +1,526 @@
+/**
+ * @file Chunk.h
+ * @brief View for splitting a range into batches of a fixed size.
+ *
+ * @author Retro & Chill
+ * https://github.com/retroandchill
+ */
+#pragma once
+
+#include "RetroLib/Functional/ExtensionMethods.h"
+#include "RetroLib/Ranges/Concepts/Containers.h"
+#include "RetroLib/Ranges/RangeBasics.h"
+#include "RetroLib/Ranges/SizeHint.h"
+#include "RetroLib/RetroLibMacros.h"
+#include "RetroLib/Utils/NonPropagatingCache.h"
+
+#if !RETROLIB_WITH_MODULES
+#include <algorithm>
+#include <compare>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <vector>
+#endif
+
+#ifndef RETROLIB_EXPORT
+#define RETROLIB_EXPORT
+#endif
+
+namespace Retro::Ranges {
+    /**
+     * Checks if the elements of a range can be copied out of it into a buffer of its value type.
+     *
+     * @tparam R The range to check
+     */
+    template <typename R>
+    concept BufferableRange = std::ranges::input_range<R> && std::movable<std::ranges::range_value_t<R>> &&
+                              std::constructible_from<std::ranges::range_value_t<R>, std::ranges::range_reference_t<R>>;
+
+    /**
+     * Divides the number of elements in a range by the size of a chunk, rounding up so that any trailing elements form
+     * a chunk of their own.
+     *
+     * @param Count The number of elements
+     * @param ChunkSize The number of elements in each chunk
+     * @return The number of chunks
+     */
+    template <std::integral T>
+    constexpr T CountChunks(T Count, T ChunkSize) noexcept {
+        return Count / ChunkSize + (Count % ChunkSize != 0 ? 1 : 0);
+    }
+
+    namespace Detail {
+        template <typename V>
+        struct TBatchSource {
+            static constexpr bool Enabled = BatchReadableRange<V>;
+
+            static constexpr V &Get(V &Base) noexcept {
+                return Base;
+            }
+        };
+
+        template <typename R>
+        struct TBatchSource<std::ranges::ref_view<R>> {
+            static constexpr bool Enabled = BatchReadableRange<R>;
+
+            static constexpr R &Get(std::ranges::ref_view<R> &Base) noexcept {
+                return Base.base();
+            }
+        };
+
+        template <typename R>
+        struct TBatchSource<std::ranges::owning_view<R>> {
+            static constexpr bool Enabled = BatchReadableRange<R>;
+
+            static constexpr R &Get(std::ranges::owning_view<R> &Base) noexcept {
+                return Base.base();
+            }
+        };
+    } // namespace Detail
+
+    /**
+     * Checks if a range can be split into batches that are spans over its own elements.
+     *
+     * @tparam R The range to check
+     */
+    template <typename R>
+    concept ContiguousChunkableRange = std::ranges::contiguous_range<R> && std::ranges::sized_range<R>;
+
+    /**
+     * Checks if a range can be split into batches, either by slicing it directly or by copying its elements into a
+     * buffer.
+     *
+     * @tparam R The range to check
+     */
+    template <typename R>
+    concept ChunkableRange = ContiguousChunkableRange<R> || BufferableRange<R>;
+
+    RETROLIB_EXPORT template <std::ranges::view V>
+        requires ChunkableRange<V>
+    class TChunkView;
+
+    /**
+     * @class TChunkView
+     * @brief A view that splits the underlying range into consecutive batches of a fixed number of elements.
+     *
+     * Every batch contains exactly the requested number of elements, except for the last one which holds whatever is
+     * left over. Batches are yielded as a `std::span` over the elements.
+     *
+     * This is the general case used for ranges that are not contiguous, which includes any single-pass range such as
+     * a generator or an any view. Each batch is copied into a buffer owned by the view, and that buffer is reused
+     * for every batch, so walking the whole range only allocates once. Ranges that can read several elements at once,
+     * such as an any view, fill the buffer with a single batch read instead of going element by element. A span
+     * yielded by this view is only valid until the iterator is advanced.
+     *
+     * Because every iterator shares the buffer owned by the view, the view is always a single-pass input range, even
+     * when the underlying range is not. This includes sized forward ranges that are not contiguous, such as a
+     * `std::deque` or a `std::list`: their batches can't be iterated twice through copies of an iterator, and calling
+     * begin() again starts a new pass that invalidates every iterator and span from the previous one.
+     *
+     * @tparam V The type of the underlying view
+     */
+    template <std::ranges::view V>
+        requires ChunkableRange<V> && (!ContiguousChunkableRange<V>)
+    class TChunkView<V> : public std::ranges::view_interface<TChunkView<V>> {
+        using ElementType = std::ranges::range_value_t<V>;
+
+        class FIterator {
+          public:
+            using iterator_concept = std::input_iterator_tag;
+            using value_type = std::span<ElementType>;
+            using difference_type = std::ranges::range_difference_t<V>;
+            using single_pass = std::true_type;
+
+            constexpr FIterator() = default;
+            constexpr explicit FIterator(TChunkView *Parent) : Parent(Parent) {
+            }
+
+            constexpr value_type operator*() const {
+                return value_type(Parent->Buffer);
+            }
+
+            constexpr FIterator &operator++() {
+                Parent->Refill();
+                return *this;
+            }
+
+            constexpr void operator++(int) {
+                ++*this;
+            }
+
+            constexpr bool operator==(std::default_sentinel_t) const {
+                return Parent->Buffer.empty();
+            }
+
+          private:
+            TChunkView *Parent = nullptr;
+        };
+
+      public:
+        /**
+         * @brief Default constructor for the ChunkView class.
+         */
+        constexpr TChunkView()
+            requires std::default_initializable<V>
+        = default;
+
+        /**
+         * @brief Constructs a ChunkView that splits the given view into batches of the given size.
+         *
+         * @param Base The view to split up
+         * @param ChunkSize The number of elements in each batch, which must be positive
+         */
+        constexpr TChunkView(V Base, std::ranges::range_difference_t<V> ChunkSize)
+            : Base(std::move(Base)), ChunkSize(ChunkSize) {
+            RETROLIB_ASSERT(ChunkSize > 0);
+        }
+
+        /**
+         * @brief Gets the underlying view.
+         *
+         * @return The view being split up
+         */
+        constexpr V GetBase() const &
+            requires std::copy_constructible<V>
+        {
+            return Base;
+        }
+
+        /**
+         * @brief Moves the underlying view out of this one.
+         *
+         * @return The view being split up
+         */
+        constexpr V GetBase() && {
+            return std::move(Base);
+        }
+
+        /**
+         * @brief Starts iterating over the view, which fills the buffer with the first batch.
+         *
+         * @return An iterator to the first batch
+         */
+        constexpr FIterator begin() {
+            Current.emplace(std::ranges::begin(Base));
+            Buffer.reserve(static_cast<size_t>(ChunkSize));
+            Refill();
+            return FIterator(this);
+        }
+
+        /**
+         * @brief Gets the end of the view.
+         *
+         * @return A sentinel that is reached once a batch comes up empty
+         */
+        constexpr std::default_sentinel_t end() const noexcept {
+            return std::default_sentinel;
+        }
+
+        /**
+         * @brief Gets the number of batches in the view.
+         *
+         * @return The number of batches
+         */
+        constexpr auto size()
+            requires std::ranges::sized_range<V>
+        {
+            using SizeType = decltype(std::ranges::size(Base));
+            return CountChunks(std::ranges::size(Base), static_cast<SizeType>(ChunkSize));
+        }
+
+        /**
+         * @brief Gets the number of batches in the view.
+         *
+         * @return The number of batches
+         */
+        constexpr auto size() const
+            requires std::ranges::sized_range<const V>
+        {
+            using SizeType = decltype(std::ranges::size(Base));
+            return CountChunks(std::ranges::size(Base), static_cast<SizeType>(ChunkSize));
+        }
+
+        /**
+         * @brief Returns the bounds on the number of batches in the view.
+         *
+         * @return The bounds on the number of batches
+         */
+        constexpr FSizeHint SizeHint() const {
+            auto Hint = Retro::Ranges::SizeHint(Base);
+            auto Size = static_cast<size_t>(ChunkSize);
+            if (Hint.UpperBound.has_value()) {
+                Hint.UpperBound = CountChunks(*Hint.UpperBound, Size);
+            }
+            return {CountChunks(Hint.LowerBound, Size), Hint.UpperBound};
+        }
+
+      private:
+        constexpr void Refill() {
+            using FBatchSource = Detail::TBatchSource<V>;
+            if constexpr (FBatchSource::Enabled && std::default_initializable<ElementType>) {
+                Buffer.resize(static_cast<size_t>(ChunkSize));
+                auto Count = FBatchSource::Get(Base).ReadBatch(*Current, std::span<ElementType>(Buffer));
+                Buffer.resize(Count);
+            } else {
+                Buffer.clear();
+                auto &It = *Current;
+                auto Last = std::ranges::end(Base);
+                for (std::ranges::range_difference_t<V> i = 0; i < ChunkSize && It != Last; ++i, ++It) {
+                    Buffer.emplace_back(*It);
+                }
+            }
+        }
+
+        V Base = V();
+        std::ranges::range_difference_t<V> ChunkSize = 0;
+        TNonPropagatingCache<std::ranges::iterator_t<V>> Current;
+        std::vector<ElementType> Buffer;
+    };
+
+    /**
+     * @class TChunkView
+     * @brief A view that splits the underlying range into consecutive batches of a fixed number of elements.
+     *
+     * This is the specialization used for ranges whose elements are stored contiguously with a known size. Each batch
+     * is a `std::span` into the underlying range, so no elements are copied, and the view is random access so batches
+     * can be handed out by index, such as when splitting work up between threads.
+     *
+     * @tparam V The type of the underlying view
+     */
+    template <std::ranges::view V>
+        requires ChunkableRange<V> && ContiguousChunkableRange<V>
+    class TChunkView<V> : public std::ranges::view_interface<TChunkView<V>> {
+
+        template <bool Const>
+        class TIterator {
+            using BaseType = std::conditional_t<Const, const V, V>;
+            using ElementType = std::remove_reference_t<std::ranges::range_reference_t<BaseType>>;
+
+          public:
+            using iterator_category = std::input_iterator_tag;
+            using iterator_concept = std::random_access_iterator_tag;
+            using value_type = std::span<ElementType>;
+            using difference_type = std::ranges::range_difference_t<BaseType>;
+
+            constexpr TIterator() = default;
+            constexpr TIterator(ElementType *Data, difference_type Size, difference_type ChunkSize,
+                                difference_type Index)
+                : Data(Data), Size(Size), ChunkSize(ChunkSize), Index(Index) {
+            }
+
+            constexpr value_type operator*() const {
+                auto Offset = Index * ChunkSize;
+                return value_type(Data + Offset, static_cast<size_t>(std::min(ChunkSize, Size - Offset)));
+            }
+
+            constexpr value_type operator[](difference_type Offset) const {
+                return *(*this + Offset);
+            }
+
+            constexpr TIterator &operator++() {
+                ++Index;
+                return *this;
+            }
+
+            constexpr TIterator operator++(int) {
+                auto Tmp = *this;
+                ++Index;
+                return Tmp;
+            }
+
+            constexpr TIterator &operator--() {
+                --Index;
+                return *this;
+            }
+
+            constexpr TIterator operator--(int) {
+                auto Tmp = *this;
+                --Index;
+                return Tmp;
+            }
+
+            constexpr TIterator &operator+=(difference_type Offset) {
+                Index += Offset;
+                return *this;
+            }
+
+            constexpr TIterator &operator-=(difference_type Offset) {
+                Index -= Offset;
+                return *this;
+            }
+
+            friend constexpr TIterator operator+(TIterator It, difference_type Offset) {
+                return It += Offset;
+            }
+
+            friend constexpr TIterator operator+(difference_type Offset, TIterator It) {
+                return It += Offset;
+            }
+
+            friend constexpr TIterator operator-(TIterator It, difference_type Offset) {
+                return It -= Offset;
+            }
+
+            friend constexpr difference_type operator-(const TIterator &Lhs, const TIterator &Rhs) {
+                return Lhs.Index - Rhs.Index;
+            }
+
+            friend constexpr bool operator==(const TIterator &Lhs, const TIterator &Rhs) {
+                return Lhs.Index == Rhs.Index;
+            }
+
+            friend constexpr auto operator<=>(const TIterator &Lhs, const TIterator &Rhs) {
+                return Lhs.Index <=> Rhs.Index;
+            }
+
+          private:
+            ElementType *Data = nullptr;
+            difference_type Size = 0;
+            difference_type ChunkSize = 0;
+            difference_type Index = 0;
+        };
+
+      public:
+        /**
+         * @brief Default constructor for the ChunkView class.
+         */
+        constexpr TChunkView()
+            requires std::default_initializable<V>
+        = default;
+
+        /**
+         * @brief Constructs a ChunkView that splits the given view into batches of the given size.
+         *
+         * @param Base The view to split up
+         * @param ChunkSize The number of elements in each batch, which must be positive
+         */
+        constexpr TChunkView(V Base, std::ranges::range_difference_t<V> ChunkSize)
+            : Base(std::move(Base)), ChunkSize(ChunkSize) {
+            RETROLIB_ASSERT(ChunkSize > 0);
+        }
+
+        /**
+         * @brief Gets the underlying view.
+         *
+         * @return The view being split up
+         */
+        constexpr V GetBase() const &
+            requires std::copy_constructible<V>
+        {
+            return Base;
+        }
+
+        /**
+         * @brief Moves the underlying view out of this one.
+         *
+         * @return The view being split up
+         */
+        constexpr V GetBase() && {
+            return std::move(Base);
+        }
+
+        /**
+         * @brief Gets an iterator to the first batch.
+         *
+         * @return An iterator to the first batch
+         */
+        constexpr TIterator<false> begin() {
+            return TIterator<false>(std::ranges::data(Base), GetElementCount(), ChunkSize, 0);
+        }
+
+        /**
+         * @brief Gets an iterator to the first batch.
+         *
+         * @return An iterator to the first batch
+         */
+        constexpr TIterator<true> begin() const
+            requires std::ranges::contiguous_range<const V> && std::ranges::sized_range<const V>
+        {
+            return TIterator<true>(std::ranges::data(Base), GetElementCount(), ChunkSize, 0);
+        }
+
+        /**
+         * @brief Gets an iterator one past the last batch.
+         *
+         * @return An iterator one past the last batch
+         */
+        constexpr TIterator<false> end() {
+            auto Size = GetElementCount();
+            return TIterator<false>(std::ranges::data(Base), Size, ChunkSize, CountChunks(Size, ChunkSize));
+        }
+
+        /**
+         * @brief Gets an iterator one past the last batch.
+         *
+         * @return An iterator one past the last batch
+         */
+        constexpr TIterator<true> end() const
+            requires std::ranges::contiguous_range<const V> && std::ranges::sized_range<const V>
+        {
+            auto Size = GetElementCount();
+            return TIterator<true>(std::ranges::data(Base), Size, ChunkSize, CountChunks(Size, ChunkSize));
+        }
+
+        /**
+         * @brief Gets the number of batches in the view.
+         *
+         * @return The number of batches
+         */
+        constexpr size_t size() const {
+            return static_cast<size_t>(CountChunks(GetElementCount(), ChunkSize));
+        }
+
+      private:
+        constexpr std::ranges::range_difference_t<V> GetElementCount() const {
+            return static_cast<std::ranges::range_difference_t<V>>(std::ranges::size(Base));
+        }
+
+        V Base = V();
+        std::ranges::range_difference_t<V> ChunkSize = 0;
+    };
+
+    /**
+     * Deduction guide for TChunkView, which wraps the range in a view.
+     *
+     * @tparam R The type of the range being split up
+     */
+    template <std::ranges::input_range R>
+    TChunkView(R &&, std::ranges::range_difference_t<R>) -> TChunkView<std::ranges::views::all_t<R>>;
+
+    namespace Views {
+        /**
+         * @brief Functor that splits a range into batches of a fixed size.
+         */
+        struct FChunkInvoker {
+            /**
+             * @brief Creates a ChunkView that splits the given range into batches of the given size.
+             *
+             * Contiguous ranges are split into spans over the original elements, while any other range is copied into
+             * a reusable buffer one batch at a time.
+             *
+             * @param Range The range to split up
+             * @param ChunkSize The number of elements in each batch, which must be positive
+             * @return A view over the batches of the range
+             */
+            template <std::ranges::input_range R>
+                requires std::ranges::viewable_range<R> && ChunkableRange<std::ranges::views::all_t<R>>
+            constexpr auto operator()(R &&Range, std::ranges::range_difference_t<R> ChunkSize) const {
+                return TChunkView(std::ranges::views::all(std::forward<R>(Range)), ChunkSize);
+            }
+        };
+
+        /**
+         * @brief Splits a range into batches of a fixed size, which are yielded as spans.
+         *
+         * This is meant for feeding kernels that work on a block of elements at a time, or for dividing a range up
+         * between workers, without having to write the batching loop by hand.
+         */
+        RETROLIB_EXPORT constexpr auto Chunk = ExtensionMethod<FChunkInvoker{}>;
+
+        /**
+         * @brief Alternate name for Chunk, for call sites that read better in terms of batches.
+         */
+        RETROLIB_EXPORT constexpr auto Batch = Chunk;
+    } // namespace Views
+} // namespace Retro::Ranges
@@ -11,12 +11,15 @@
 #include "RetroLib/Ranges/Concepts/Concatable.h"
 #include "RetroLib/Concepts/ParameterPacks.h"
 #include "RetroLib/Ranges/RangeBasics.h"
+#include "RetroLib/Ranges/Segments.h"
+#include "RetroLib/Ranges/SizeHint.h"
+#include "RetroLib/Utils/TaggedUnion.h"
 #include "RetroLib/Utils/Unreachable.h"
-#include "RetroLib/Utils/Variant.h"
 
 #if !RETROLIB_WITH_MODULES
+#include <algorithm>
+#include <array>
 #include <tuple>
-#include <variant>
 #endif
 
 #ifndef RETROLIB_EXPORT
@@ -24,6 +27,11 @@
 #endif
 
 namespace Retro::Ranges {
+    /**
+     * The largest number of ranges for which TConcatView finds the range to seek to with a linear scan of the cached
+     * offsets, instead of a binary search.
+     */
+    constexpr size_t CONCAT_LINEAR_SEEK_MAX_RANGES = 8;
 
     /**
      * @class TConcatView
@@ -45,6 +53,11 @@ namespace Retro::Ranges {
      * - Allows seamless transition between different ranges during iteration.
      * - Provides a unified view interface over non-contiguous or individually defined ranges.
      * - Memory-efficient, as it operates directly over the given ranges without copying their contents.
+     * - When every range is sized and random access, the offset of each range is cached on construction, so seeking
+     *   only needs a short scan or a binary search over the offsets instead of walking the ranges one by one, and
+     *   computing distances takes constant time. The ranges must not be resized while the view is in use.
+     * - The iterator keeps the iterator of the active range in a TTaggedUnion, so stepping between elements is a switch
+     *   over a one byte index. When every range has the same iterator type, only a single iterator is stored.
      *
      */
     RETROLIB_EXPORT template <std::ranges::input_range... R>
@@ -52,8 +65,22 @@ namespace Retro::Ranges {
     class TConcatView : public std::ranges::view_interface<TConcatView<R...>> {
         using DifferenceType = std::common_type_t<std::ranges::range_difference_t<R>...>;
         static constexpr size_t RangesSize = sizeof...(R);
+
+        /**
+         * Whether the offset of each range within the view can be cached, which lets iterators seek to any position
+         * without stepping through the ranges in between.
+         */
+        static constexpr bool bIndexable =
+            ((std::ranges::random_access_range<R> && std::ranges::sized_range<R>) && ...);
+
         std::tuple<R...> Ranges;
 
+        /**
+         * The index of the first element of each range within the view, followed by the size of the view. Only
+         * populated when the view is indexable.
+         */
+        std::array<DifferenceType, RangesSize + 1> Offsets = {};
+
         template <bool IsConst>
         struct TIterator;
 
@@ -70,7 +97,7 @@ namespace Retro::Ranges {
           public:
             constexpr TSentinel() = default;
             explicit constexpr TSentinel(ConcatViewType &View, FEndTag)
-                : EndElement(std::ranges::end(std::get<RangesSize - 1>(View.ranges))) {
+                : EndElement(std::ranges::end(std::get<RangesSize - 1>(View.Ranges))) {
             }
 
             template <bool Other>
@@ -90,14 +117,14 @@ namespace Retro::Ranges {
             using ConstifyIf = std::conditional_t<IsConst, std::add_const_t<T>, T>;
             using ConcatViewType = ConstifyIf<TConcatView>;
             ConcatViewType *View;
-            std::variant<std::ranges::iterator_t<ConstifyIf<R>>...> It;
+            TTaggedUnion<std::ranges::iterator_t<ConstifyIf<R>>...> It;
 
             template <size_t N>
             constexpr void Satisfy() {
-                RETROLIB_ASSERT(It.index() == N);
+                RETROLIB_ASSERT(It.GetIndex() == N);
                 if constexpr (N < RangesSize - 1) {
-                    if (std::get<N>(It) == std::ranges::end(std::get<N>(View->Ranges))) {
-                        It.template emplace<N + 1>(std::ranges::begin(std::get<N + 1>(View->Ranges)));
+                    if (It.template Get<N>() == std::ranges::end(std::get<N>(View->Ranges))) {
+                        It.template Emplace<N + 1>(std::ranges::begin(std::get<N + 1>(View->Ranges)));
                         Satisfy<N + 1>();
                     }
                 }
@@ -127,7 +154,7 @@ namespace Retro::Ranges {
                 constexpr void operator()(TIndexedElement<I, N> It) const {
                     if (It.Get() == std::ranges::begin(std::get<N>(Pos->View->Ranges))) {
                         auto &&Rng = std::get<N - 1>(Pos->View->Ranges);
-                        Pos->It.template emplace<N - 1>(
+                        Pos->It.template Emplace<N - 1>(
                             std::ranges::next(std::ranges::begin(Rng), std::ranges::end(Rng)));
                         VisitIndex(*this, Pos->It);
                     } else {
@@ -171,7 +198,7 @@ namespace Retro::Ranges {
                     auto First = std::ranges::begin(std::get<N>(Pos->View->Ranges));
                     if (It.Get() == First) {
                         auto &&Rng = std::get<N - 1>(Pos->View->Ranges);
-                        Pos->It.template emplace<N - 1>(
+                        Pos->It.template Emplace<N - 1>(
                             std::ranges::next(std::ranges::begin(Rng), std::ranges::end(Rng)));
                         VisitIndex(*this, Pos->It);
                     } else {
@@ -183,35 +210,83 @@ namespace Retro::Ranges {
                 }
             };
 
-            [[noreturn]] static difference_type DistanceTo(std::integral_constant<size_t, RangesSize>,
-                                                            const TIterator &, const TIterator &) {
+            [[noreturn]] static constexpr difference_type DistanceTo(std::integral_constant<size_t, RangesSize>,
+                                                                      const TIterator &, const TIterator &) {
                 RETROLIB_ASSERT(false);
                 Unreachable();
             }
 
             template <size_t N>
                 requires(N < RangesSize)
-            static difference_type DistanceTo(std::integral_constant<size_t, N>, const TIterator &From,
-                                               const TIterator &To) {
-                if (From.It.index() > N) {
+            static constexpr difference_type DistanceTo(std::integral_constant<size_t, N>, const TIterator &From,
+                                                         const TIterator &To) {
+                if (From.It.GetIndex() > N) {
                     return TIterator::DistanceTo(std::integral_constant<size_t, N + 1>{}, From, To);
                 }
 
-                if (From.It.index() == N) {
-                    if (To.It.index() == N) {
-                        return std::ranges::distance(std::get<N>(From.It), std::get<N>(To.It));
+                if (From.It.GetIndex() == N) {
+                    if (To.It.GetIndex() == N) {
+                        return std::ranges::distance(From.It.template Get<N>(), To.It.template Get<N>());
                     }
 
-                    return std::ranges::distance(std::get<N>(From.It),
+                    return std::ranges::distance(From.It.template Get<N>(),
                                                  std::ranges::end(std::get<N>(From.View->Ranges))) +
                            TIterator::DistanceTo(std::integral_constant<size_t, N + 1>{}, From, To);
                 }
-                if (From.It.index() < N && To.It.index() > N)
+                if (From.It.GetIndex() < N && To.It.GetIndex() > N)
                     return std::ranges::distance(std::get<N>(From.View->Ranges)) +
                            TIterator::DistanceTo(std::integral_constant<size_t, N + 1>{}, From, To);
 
-                RETROLIB_ASSERT(To.It.index() == N);
-                return std::ranges::distance(std::ranges::begin(std::get<N>(From.View->Ranges)), std::get<N>(To.It));
+                RETROLIB_ASSERT(To.It.GetIndex() == N);
+                return std::ranges::distance(std::ranges::begin(std::get<N>(From.View->Ranges)),
+                                             To.It.template Get<N>());
+            }
+
+            /**
+             * Gets the position of this iterator within the view, using the cached offsets of the ranges.
+             */
+            constexpr difference_type GetIndex() const
+                requires bIndexable
+            {
+                return VisitIndex<difference_type>(
+                    [this]<typename I, size_t N>(TIndexedElement<I, N> Element) {
+                        return View->Offsets[N] + static_cast<difference_type>(
+                                                      Element.Get() - std::ranges::begin(std::get<N>(View->Ranges)));
+                    },
+                    It);
+            }
+
+            /**
+             * Moves this iterator to the given position within the view. The range containing the position is found
+             * using the cached offsets of the ranges, which is a short linear scan when there are only a few ranges,
+             * and a binary search otherwise.
+             *
+             * @param Index The position to move to
+             */
+            constexpr void SeekTo(difference_type Index)
+                requires bIndexable
+            {
+                // The position belongs to the first range that ends after it, which skips over empty ranges. The end of
+                // the view belongs to the last range.
+                size_t Segment = RangesSize - 1;
+                if constexpr (RangesSize <= CONCAT_LINEAR_SEEK_MAX_RANGES) {
+                    for (size_t i = 0; i < RangesSize - 1; i++) {
+                        if (Index < View->Offsets[i + 1]) {
+                            Segment = i;
+                            break;
+                        }
+                    }
+                } else {
+                    auto First = View->Offsets.begin() + 1;
+                    Segment = static_cast<size_t>(std::upper_bound(First, First + (RangesSize - 1), Index) - First);
+                }
+
+                [this, Segment, Index]<size_t... N>(std::index_sequence<N...>) {
+                    ((Segment == N && (It.template Emplace<N>(std::ranges::begin(std::get<N>(View->Ranges)) +
+                                                              (Index - View->Offsets[N])),
+                                       true)) ||
+                     ...);
+                }(std::make_index_sequence<RangesSize>{});
             }
 
           public:
@@ -236,8 +311,11 @@ namespace Retro::Ranges {
             }
 
             constexpr Reference operator*() const {
-                return std::visit<Reference>([]<typename T>(T &&It) -> decltype(auto) { return *std::forward<T>(It); },
-                                             It);
+                if constexpr (decltype(It)::bSharedAlternative) {
+                    return *It.GetShared();
+                } else {
+                    return VisitIndex<Reference>([](auto Element) -> Reference { return *Element.Get(); }, It);
+                }
             }
 
             constexpr TIterator &operator++() {
@@ -256,13 +334,13 @@ namespace Retro::Ranges {
             }
 
             constexpr bool operator==(const TIterator &pos) const
-                requires std::equality_comparable<std::variant<std::ranges::iterator_t<ConstifyIf<R>>...>>
+                requires(std::equality_comparable<std::ranges::iterator_t<ConstifyIf<R>>> && ...)
             {
                 return It == pos.It;
             }
 
             constexpr bool operator==(const TSentinel<IsConst> &Post) const {
-                return It.index() == RangesSize - 1 && std::get<RangesSize - 1>(View->it) == Post.EndElement;
+                return It.GetIndex() == RangesSize - 1 && It.template Get<RangesSize - 1>() == Post.EndElement;
             }
 
             constexpr std::partial_ordering operator<=>(const TIterator &Other) const
@@ -314,7 +392,9 @@ namespace Retro::Ranges {
             constexpr TIterator &operator+=(difference_type N)
                 requires(std::random_access_iterator<std::ranges::iterator_t<R>> && ...)
             {
-                if (N > 0) {
+                if constexpr (bIndexable) {
+                    SeekTo(GetIndex() + N);
+                } else if (N > 0) {
                     VisitIndex<void>(AdvanceForward{this, N}, It);
                 } else if (N < 0) {
                     VisitIndex<void>(AdvanceReverse{this, N}, It);
@@ -333,7 +413,11 @@ namespace Retro::Ranges {
             constexpr difference_type operator-(const TIterator &Other) const
                 requires(std::sized_sentinel_for<std::ranges::iterator_t<R>, std::ranges::iterator_t<R>> && ...)
             {
-                if (It.index() <= Other.It.index()) {
+                if constexpr (bIndexable) {
+                    return GetIndex() - Other.GetIndex();
+                }
+
+                if (It.GetIndex() <= Other.It.GetIndex()) {
                     return -TIterator::DistanceTo(std::integral_constant<size_t, 0>{}, *this, Other);
                 }
 
@@ -375,6 +459,13 @@ namespace Retro::Ranges {
          * @param Ranges Variadic parameter pack representing the ranges to be concatenated.
          */
         constexpr explicit TConcatView(R... Ranges) : Ranges(std::move(Ranges)...) {
+            if constexpr (bIndexable) {
+                [this]<size_t... N>(std::index_sequence<N...>) {
+                    ((Offsets[N + 1] =
+                          Offsets[N] + static_cast<DifferenceType>(std::ranges::size(std::get<N>(this->Ranges)))),
+                     ...);
+                }(std::make_index_sequence<RangesSize>{});
+            }
         }
 
         /**
@@ -455,6 +546,48 @@ namespace Retro::Ranges {
         {
             return std::apply([](auto &...r) { return (std::ranges::size(r) + ...); }, Ranges);
         }
+
+        /**
+         * @brief Computes the bounds on the total number of elements of all ranges.
+         *
+         * This is used when not every range is sized, in which case the bounds of each range are added together.
+         *
+         * @return The bounds on the number of elements in the view.
+         */
+        constexpr FSizeHint SizeHint() const {
+            return std::apply([](auto &...r) { return (Retro::Ranges::SizeHint(r) + ...); }, Ranges);
+        }
+
+        /**
+         * @brief Invokes a functor on each of the concatenated ranges in order, stopping early if it returns false.
+         *
+         * This lets algorithms run a separate loop over each range, instead of dispatching on the active range for
+         * every element like the iterator of this view has to.
+         *
+         * @param Functor The functor to invoke on each range
+         * @return Were all the ranges visited
+         */
+        template <typename F>
+        constexpr bool ForEachSegment(F &&Functor) {
+            return std::apply([&Functor](auto &...r) { return (Retro::Ranges::ForEachSegment(r, Functor) && ...); },
+                              Ranges);
+        }
+
+        /**
+         * @brief Invokes a functor on each of the concatenated ranges in order, stopping early if it returns false.
+         *
+         * This lets algorithms run a separate loop over each range, instead of dispatching on the active range for
+         * every element like the iterator of this view has to.
+         *
+         * @param Functor The functor to invoke on each range
+         * @return Were all the ranges visited
+         */
+        template <typename F>
+            requires(std::ranges::range<const R> && ...)
+        constexpr bool ForEachSegment(F &&Functor) const {
+            return std::apply([&Functor](auto &...r) { return (Retro::Ranges::ForEachSegment(r, Functor) && ...); },
+                              Ranges);
+        }
     };
 
     /**
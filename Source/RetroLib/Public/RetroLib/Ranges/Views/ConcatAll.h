@@ -0,0 +1,490 @@
+/**
+ * @file ConcatAll.h
+ * @brief View for concatenating a runtime sized range of ranges.
+ *
+ * @author Retro & Chill
+ * https://github.com/retroandchill
+ */
+#pragma once
+
+#include "RetroLib/Functional/ExtensionMethods.h"
+#include "RetroLib/Ranges/RangeBasics.h"
+#include "RetroLib/Ranges/Segments.h"
+#include "RetroLib/Ranges/SizeHint.h"
+#include "RetroLib/Utils/NonPropagatingCache.h"
+
+#if !RETROLIB_WITH_MODULES
+#include <algorithm>
+#include <iterator>
+#include <ranges>
+#include <type_traits>
+#include <vector>
+#endif
+
+#ifndef RETROLIB_EXPORT
+#define RETROLIB_EXPORT
+#endif
+
+namespace Retro::Ranges {
+    /**
+     * Concept for a range of ranges that can be concatenated by TConcatAllView. The outer range must be a forward
+     * range whose elements are references to forward ranges that it owns or refers to, such as a vector of vectors or
+     * a vector of spans, so that each segment stays alive for as long as the outer range does.
+     *
+     * @tparam R The type of the range of ranges
+     */
+    template <typename R>
+    concept ConcatAllCompatible =
+        std::ranges::forward_range<R> && std::is_lvalue_reference_v<std::ranges::range_reference_t<R>> &&
+        std::ranges::forward_range<std::remove_reference_t<std::ranges::range_reference_t<R>>>;
+
+    /**
+     * @class TConcatAllView
+     * @brief A view that concatenates a range of ranges, whose number is only known at runtime, into a single range.
+     *
+     * Unlike TConcatView, the segments all have the same type and are stored in another range, such as the per-thread
+     * output buffers of a parallel job. Unlike `std::views::join`, when the segments are sized the view is sized as
+     * well, and when both the outer range and the segments are random access the view is random access, with the
+     * target segment of a seek found by a binary search over the prefix sums of the segment sizes. The view is also a
+     * segmented range, so Reduce and To process each segment with its own loop.
+     *
+     * @note When the segments are sized, the prefix sums of their sizes are cached the first time they are needed, and
+     * are computed again every time begin() is called. The cache is not copied along with the view, so copying it stays
+     * cheap. Resizing a segment invalidates the cache, along with every iterator obtained before, until begin() is
+     * called again.
+     *
+     * @tparam R The type of the range of ranges
+     */
+    RETROLIB_EXPORT template <std::ranges::view R>
+        requires ConcatAllCompatible<R>
+    class TConcatAllView : public std::ranges::view_interface<TConcatAllView<R>> {
+        template <typename T>
+        using TSegmentType = std::remove_reference_t<std::ranges::range_reference_t<T>>;
+
+        using DifferenceType =
+            std::common_type_t<std::ranges::range_difference_t<R>, std::ranges::range_difference_t<TSegmentType<R>>>;
+
+        static constexpr bool bSizedSegments = std::ranges::sized_range<TSegmentType<R>>;
+
+        template <typename T>
+        static constexpr bool bRandomAccess =
+            bSizedSegments && std::ranges::random_access_range<T> && std::ranges::sized_range<T> &&
+            std::ranges::random_access_range<TSegmentType<T>> && std::ranges::sized_range<TSegmentType<T>>;
+
+        template <typename T>
+        static constexpr bool bBidirectional =
+            std::ranges::bidirectional_range<T> && std::ranges::common_range<T> &&
+            std::ranges::bidirectional_range<TSegmentType<T>> && std::ranges::common_range<TSegmentType<T>>;
+
+        template <bool IsConst>
+        class TIterator {
+            template <typename T>
+            using ConstifyIf = std::conditional_t<IsConst, std::add_const_t<T>, T>;
+            using FParent = ConstifyIf<TConcatAllView>;
+            using FBase = ConstifyIf<R>;
+            using FSegment = TSegmentType<FBase>;
+            using FOuterIterator = std::ranges::iterator_t<FBase>;
+            using FInnerIterator = std::ranges::iterator_t<FSegment>;
+
+          public:
+            using value_type = std::ranges::range_value_t<FSegment>;
+            using difference_type = DifferenceType;
+            using iterator_concept =
+                std::conditional_t<bRandomAccess<FBase>, std::random_access_iterator_tag,
+                                   std::conditional_t<bBidirectional<FBase>, std::bidirectional_iterator_tag,
+                                                      std::forward_iterator_tag>>;
+
+            constexpr TIterator() = default;
+
+            constexpr TIterator(FParent &Parent, FBeginTag)
+                : Parent(&Parent), Outer(std::ranges::begin(Parent.Base)) {
+                Satisfy();
+            }
+
+            constexpr TIterator(FParent &Parent, FEndTag) : Parent(&Parent), Outer(std::ranges::end(Parent.Base)) {
+            }
+
+            template <bool Other>
+                requires IsConst && (!Other) && std::convertible_to<std::ranges::iterator_t<R>, FOuterIterator> &&
+                         std::convertible_to<std::ranges::iterator_t<TSegmentType<R>>, FInnerIterator>
+            constexpr explicit TIterator(TIterator<Other> Iterator)
+                : Parent(Iterator.Parent), Outer(std::move(Iterator.Outer)), Inner(std::move(Iterator.Inner)) {
+            }
+
+            constexpr decltype(auto) operator*() const {
+                return *Inner;
+            }
+
+            constexpr TIterator &operator++() {
+                ++Inner;
+                if (Inner == std::ranges::end(*Outer)) {
+                    ++Outer;
+                    Satisfy();
+                }
+                return *this;
+            }
+
+            constexpr TIterator operator++(int) {
+                auto Tmp = *this;
+                ++*this;
+                return Tmp;
+            }
+
+            constexpr TIterator &operator--()
+                requires bBidirectional<FBase>
+            {
+                if (Outer == std::ranges::end(Parent->Base) || Inner == std::ranges::begin(*Outer)) {
+                    do {
+                        --Outer;
+                    } while (std::ranges::empty(*Outer));
+                    Inner = std::ranges::end(*Outer);
+                }
+                --Inner;
+                return *this;
+            }
+
+            constexpr TIterator operator--(int)
+                requires bBidirectional<FBase>
+            {
+                auto Tmp = *this;
+                --*this;
+                return Tmp;
+            }
+
+            constexpr bool operator==(const TIterator &Other) const {
+                return Outer == Other.Outer && Inner == Other.Inner;
+            }
+
+            constexpr bool operator==(std::default_sentinel_t) const {
+                return Outer == std::ranges::end(Parent->Base);
+            }
+
+            constexpr auto operator<=>(const TIterator &Other) const
+                requires bRandomAccess<FBase>
+            {
+                return GetIndex() <=> Other.GetIndex();
+            }
+
+            constexpr TIterator &operator+=(difference_type N)
+                requires bRandomAccess<FBase>
+            {
+                SeekTo(GetIndex() + N);
+                return *this;
+            }
+
+            constexpr TIterator &operator-=(difference_type N)
+                requires bRandomAccess<FBase>
+            {
+                return *this += -N;
+            }
+
+            constexpr TIterator operator+(difference_type N) const
+                requires bRandomAccess<FBase>
+            {
+                auto Tmp = *this;
+                Tmp += N;
+                return Tmp;
+            }
+
+            friend constexpr TIterator operator+(difference_type N, const TIterator &Iterator)
+                requires bRandomAccess<FBase>
+            {
+                return Iterator + N;
+            }
+
+            constexpr TIterator operator-(difference_type N) const
+                requires bRandomAccess<FBase>
+            {
+                auto Tmp = *this;
+                Tmp -= N;
+                return Tmp;
+            }
+
+            constexpr difference_type operator-(const TIterator &Other) const
+                requires bRandomAccess<FBase>
+            {
+                return GetIndex() - Other.GetIndex();
+            }
+
+            friend constexpr difference_type operator-(std::default_sentinel_t, const TIterator &Iterator)
+                requires bRandomAccess<FBase>
+            {
+                return Iterator.Parent->GetOffsets().back() - Iterator.GetIndex();
+            }
+
+            friend constexpr difference_type operator-(const TIterator &Iterator, std::default_sentinel_t)
+                requires bRandomAccess<FBase>
+            {
+                return Iterator.GetIndex() - Iterator.Parent->GetOffsets().back();
+            }
+
+            constexpr decltype(auto) operator[](difference_type N) const
+                requires bRandomAccess<FBase>
+            {
+                return *(*this + N);
+            }
+
+          private:
+            friend class TIterator<!IsConst>;
+
+            /**
+             * Moves forward to the first element of the next non-empty segment, or to the end of the view if there is
+             * none.
+             */
+            constexpr void Satisfy() {
+                for (; Outer != std::ranges::end(Parent->Base); ++Outer) {
+                    Inner = std::ranges::begin(*Outer);
+                    if (Inner != std::ranges::end(*Outer)) {
+                        return;
+                    }
+                }
+                Inner = FInnerIterator();
+            }
+
+            constexpr difference_type GetIndex() const {
+                const auto &Offsets = Parent->GetOffsets();
+                auto Segment = Outer - std::ranges::begin(Parent->Base);
+                if (Outer == std::ranges::end(Parent->Base)) {
+                    return Offsets[Segment];
+                }
+
+                return Offsets[Segment] + (Inner - std::ranges::begin(*Outer));
+            }
+
+            constexpr void SeekTo(difference_type Index) {
+                const auto &Offsets = Parent->GetOffsets();
+                if (Outer != std::ranges::end(Parent->Base)) {
+                    // Short seeks usually stay within the current segment, which does not need a search
+                    auto Segment = Outer - std::ranges::begin(Parent->Base);
+                    if (Index >= Offsets[Segment] && Index < Offsets[Segment + 1]) {
+                        Inner = std::ranges::begin(*Outer) + (Index - Offsets[Segment]);
+                        return;
+                    }
+                }
+
+                // The segment containing the element is the last one whose offset is not past the index, which also
+                // skips over any empty segments that share its offset
+                auto Segment = std::ranges::upper_bound(Offsets, Index) - Offsets.begin() - 1;
+                Outer = std::ranges::begin(Parent->Base) + Segment;
+                if (Outer == std::ranges::end(Parent->Base)) {
+                    Inner = FInnerIterator();
+                    return;
+                }
+
+                Inner = std::ranges::begin(*Outer) + (Index - Offsets[Segment]);
+            }
+
+            FParent *Parent = nullptr;
+            FOuterIterator Outer = FOuterIterator();
+            FInnerIterator Inner = FInnerIterator();
+        };
+
+      public:
+        /**
+         * @brief Default constructor for the TConcatAllView class.
+         */
+        constexpr TConcatAllView()
+            requires std::default_initializable<R>
+        = default;
+
+        /**
+         * @brief Constructs a view over the given range of ranges.
+         *
+         * @param Base The range of ranges to concatenate
+         */
+        constexpr explicit TConcatAllView(R Base) : Base(std::move(Base)) {
+        }
+
+        /**
+         * @brief Gets the underlying range of ranges.
+         *
+         * @return A copy of the underlying range
+         */
+        constexpr R base() const &
+            requires std::copy_constructible<R>
+        {
+            return Base;
+        }
+
+        /**
+         * @brief Gets the underlying range of ranges.
+         *
+         * @return The underlying range, moved out of the view
+         */
+        constexpr R base() && {
+            return std::move(Base);
+        }
+
+        constexpr auto begin() {
+            BuildOffsets(Base);
+            return TIterator<SimpleView<R>>(*this, FBeginTag{});
+        }
+
+        constexpr auto begin() const
+            requires ConcatAllCompatible<const R>
+        {
+            BuildOffsets(Base);
+            return TIterator<true>(*this, FBeginTag{});
+        }
+
+        constexpr auto end() {
+            if constexpr (std::ranges::common_range<R>) {
+                return TIterator<SimpleView<R>>(*this, FEndTag{});
+            } else {
+                return std::default_sentinel;
+            }
+        }
+
+        constexpr auto end() const
+            requires ConcatAllCompatible<const R>
+        {
+            if constexpr (std::ranges::common_range<const R>) {
+                return TIterator<true>(*this, FEndTag{});
+            } else {
+                return std::default_sentinel;
+            }
+        }
+
+        /**
+         * @brief Gets the total number of elements in all the segments.
+         *
+         * @return The size of the view
+         */
+        constexpr size_t size()
+            requires bSizedSegments
+        {
+            return static_cast<size_t>(GetOffsets().back());
+        }
+
+        /**
+         * @brief Gets the total number of elements in all the segments.
+         *
+         * @return The size of the view
+         */
+        constexpr size_t size() const
+            requires bSizedSegments && ConcatAllCompatible<const R>
+        {
+            return static_cast<size_t>(GetOffsets().back());
+        }
+
+        /**
+         * @brief Computes the bounds on the total number of elements of all the segments, by adding together the
+         * bounds of each one.
+         *
+         * @return The bounds on the number of elements in the view
+         */
+        constexpr FSizeHint SizeHint() {
+            FSizeHint Result = FSizeHint::Exact(0);
+            for (auto &Segment : Base) {
+                Result = Result + Retro::Ranges::SizeHint(Segment);
+            }
+            return Result;
+        }
+
+        /**
+         * @brief Invokes a functor on each of the segments in order, stopping early if it returns false.
+         *
+         * @param Functor The functor to invoke on each segment
+         * @return Were all the segments visited
+         */
+        template <typename F>
+        constexpr bool ForEachSegment(F &&Functor) {
+            for (auto &Segment : Base) {
+                if (!Retro::Ranges::ForEachSegment(Segment, Functor)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /**
+         * @brief Invokes a functor on each of the segments in order, stopping early if it returns false.
+         *
+         * @param Functor The functor to invoke on each segment
+         * @return Were all the segments visited
+         */
+        template <typename F>
+            requires ConcatAllCompatible<const R>
+        constexpr bool ForEachSegment(F &&Functor) const {
+            for (auto &Segment : Base) {
+                if (!Retro::Ranges::ForEachSegment(Segment, Functor)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+      private:
+        /**
+         * Computes the offset of each segment from the current sizes of the segments, replacing any cached offsets.
+         *
+         * @param Segments The range of segments, accessed with the same constness as the view
+         */
+        template <typename B>
+        constexpr void BuildOffsets(B &Segments) const {
+            if constexpr (bSizedSegments) {
+                auto &Result = Offsets.emplace();
+                if constexpr (std::ranges::sized_range<B>) {
+                    Result.reserve(std::ranges::size(Segments) + 1);
+                }
+
+                Result.push_back(0);
+                for (auto &Segment : Segments) {
+                    Result.push_back(Result.back() + static_cast<DifferenceType>(std::ranges::size(Segment)));
+                }
+            }
+        }
+
+        constexpr const std::vector<DifferenceType> &GetOffsets()
+            requires bSizedSegments
+        {
+            if (!Offsets.has_value()) {
+                BuildOffsets(Base);
+            }
+            return *Offsets;
+        }
+
+        constexpr const std::vector<DifferenceType> &GetOffsets() const
+            requires bSizedSegments && ConcatAllCompatible<const R>
+        {
+            if (!Offsets.has_value()) {
+                BuildOffsets(Base);
+            }
+            return *Offsets;
+        }
+
+        R Base = R();
+        mutable TNonPropagatingCache<std::vector<DifferenceType>, void, bSizedSegments> Offsets;
+    };
+
+    /**
+     * Deduction guide that wraps the range of ranges in a view.
+     */
+    template <typename R>
+    TConcatAllView(R &&) -> TConcatAllView<std::ranges::views::all_t<R>>;
+
+    namespace Views {
+        /**
+         * @brief Functor for creating a TConcatAllView from a range of ranges.
+         */
+        struct FConcatAllInvoker {
+            /**
+             * @brief Creates a view that concatenates each of the ranges in the given range.
+             *
+             * @param Range The range of ranges to concatenate
+             * @return A TConcatAllView over the range
+             */
+            template <std::ranges::viewable_range R>
+                requires ConcatAllCompatible<std::ranges::views::all_t<R>>
+            constexpr auto operator()(R &&Range) const {
+                return TConcatAllView(std::ranges::views::all(std::forward<R>(Range)));
+            }
+        };
+
+        /**
+         * @brief Concatenates a range of ranges, such as a vector of buffers, into a single range. The number of
+         * ranges only needs to be known at runtime.
+         */
+        RETROLIB_EXPORT constexpr auto ConcatAll = ExtensionMethod<FConcatAllInvoker{}>();
+    } // namespace views
+} // namespace retro::ranges
@@ -12,6 +12,7 @@
 #include "RetroLib/Concepts/Tuples.h"
 #include "RetroLib/Functional/ExtensionMethods.h"
 #include "RetroLib/Ranges/RangeBasics.h"
+#include "RetroLib/Ranges/SizeHint.h"
 #endif
 
 #ifndef RETROLIB_EXPORT
@@ -445,6 +446,15 @@ namespace Retro::Ranges {
             return std::ranges::size(Range);
         }
 
+        /**
+         * @brief Returns the bounds on the number of elements of the underlying range.
+         *
+         * @return The bounds on the number of elements in the view.
+         */
+        constexpr FSizeHint SizeHint() const {
+            return Retro::Ranges::SizeHint(Range);
+        }
+
       private:
         R Range;
     };
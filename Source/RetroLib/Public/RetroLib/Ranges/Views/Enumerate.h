@@ -12,6 +12,7 @@
 #include "RetroLib/Functional/ExtensionMethods.h"
 #include "RetroLib/Ranges/FeatureBridge.h"
 #include "RetroLib/Ranges/RangeBasics.h"
+#include "RetroLib/Ranges/SizeHint.h"
 #include "RetroLib/Utils/NonPropagatingCache.h"
 
 #if !RETROLIB_WITH_MODULES
@@ -37,19 +38,19 @@ namespace Retro::Ranges {
         constexpr TEnumerateViewResult() requires std::default_initializable<T> && std::default_initializable<U> = default;
 
         template <typename A, typename B>
-            requires std::convertible_to<A, T> && std::convertible_to<B, T>
+            requires std::convertible_to<A, T> && std::convertible_to<B, U>
         constexpr TEnumerateViewResult(A&& Index, B&& Value) noexcept : Index(std::forward<A>(Index)), Value(std::forward<B>(Value)) {}
 
         template <typename A, typename B>
-            requires std::convertible_to<A&, T> && std::convertible_to<B&, T>
+            requires std::convertible_to<A&, T> && std::convertible_to<B&, U>
         constexpr explicit(false) TEnumerateViewResult(TEnumerateViewResult<A, B>& Tuple) : Index(Tuple.Index), Value(Tuple.Value) {}
 
         template <typename A, typename B>
-            requires std::convertible_to<const A&, T> && std::convertible_to<const B&, T>
+            requires std::convertible_to<const A&, T> && std::convertible_to<const B&, U>
         constexpr explicit(false) TEnumerateViewResult(const TEnumerateViewResult<A, B>& Tuple) : Index(Tuple.Index), Value(Tuple.Value) {}
 
         template <typename A, typename B>
-            requires std::convertible_to<A, T> && std::convertible_to<B, T>
+            requires std::convertible_to<A, T> && std::convertible_to<B, U>
         constexpr explicit(false) TEnumerateViewResult(TEnumerateViewResult<A, B>&& Tuple) : Index(std::forward<A>(Tuple.Index)), Value(std::forward<B>(Tuple.Value)) {}
 
         template <typename A, typename B>
@@ -279,6 +280,8 @@ namespace Retro::Ranges {
             }
 
           private:
+            friend class TEnumerateView;
+
             constexpr explicit TSentinel(std::ranges::sentinel_t<BaseType> End) : End(std::move(End)) {
             }
 
@@ -463,6 +466,15 @@ namespace Retro::Ranges {
             return std::ranges::size(View);
         }
 
+        /**
+         * @brief Returns the bounds on the number of elements of the underlying range.
+         *
+         * @return The bounds on the number of elements in the view.
+         */
+        constexpr FSizeHint SizeHint() const {
+            return Retro::Ranges::SizeHint(View);
+        }
+
       private:
         friend class TEnumerateView;
 
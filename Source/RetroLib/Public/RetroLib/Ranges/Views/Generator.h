@@ -9,6 +9,8 @@
 
 #if RETROLIB_WITH_COROUTINES
 
+#include "RetroLib/Ranges/Views/GeneratorFramePool.h"
+
 #if !RETROLIB_WITH_MODULES
 #include "RetroLib/RetroLibMacros.h"
 
@@ -480,7 +482,7 @@ namespace std {
     // Type-erased allocator with default allocator behaviour.
     RETROLIB_EXPORT template <typename R, typename V, typename... A>
     struct coroutine_traits<Retro::TGenerator<R, V>, A...> {
-        using promise_type = Retro::TGeneratorPromise<Retro::TGenerator<R, V>, std::allocator<std::byte>>;
+        using promise_type = Retro::TGeneratorPromise<Retro::TGenerator<R, V>, Retro::FDefaultGeneratorFrameAllocator>;
     };
 
     // Type-erased allocator with std::allocator_arg parameter
@@ -558,7 +560,7 @@ namespace Retro {
          * @return A newly constructed Generator object with the transferred resources.
          */
         TGenerator(TGenerator &&Other) noexcept
-            : Coroutine(std::exchange(Other.coroutine, {})), Started(std::exchange(Other.started, false)) {
+            : Coroutine(std::exchange(Other.Coroutine, {})), Started(std::exchange(Other.Started, false)) {
         }
 
         /**
@@ -573,7 +575,7 @@ namespace Retro {
         ~TGenerator() noexcept {
             if (Coroutine) {
                 if (Started && !Coroutine.done()) {
-                    Coroutine.promise().value.destruct();
+                    Coroutine.promise().Value.Destruct();
                 }
                 Coroutine.destroy();
             }
@@ -604,8 +606,8 @@ namespace Retro {
          * @param other The Generator object to swap with.
          */
         void swap(TGenerator &other) noexcept {
-            std::swap(Coroutine, other.coroutine);
-            std::swap(Started, other.started);
+            std::swap(Coroutine, other.Coroutine);
+            std::swap(Started, other.Started);
         }
 
     private:
@@ -639,7 +641,7 @@ namespace Retro {
             }
 
             Iterator &operator++() {
-                Coroutine.promise().value.destruct();
+                Coroutine.promise().Value.Destruct();
                 Coroutine.promise().resume();
                 return *this;
             }
@@ -935,6 +937,16 @@ namespace Retro {
         std::coroutine_handle<> Coroutine;
         bool Started = false;
     };
+
+    /**
+     * A generator whose coroutine frame is always obtained from the thread-local FGeneratorFramePool, which avoids a
+     * trip to the global heap for generators that are created and destroyed frequently.
+     *
+     * @tparam R The reference type of the generator
+     * @tparam V The value type of the generator (defaults to the cvref unqualified version of R)
+     */
+    RETROLIB_EXPORT template <typename R, typename V = std::remove_cvref_t<R>>
+    using TPooledGenerator = TGenerator<R, V, TGeneratorFrameAllocator<std::byte>>;
 } // namespace retro
 
 #endif
\ No newline at end of file
@@ -0,0 +1,253 @@
+/**
+ * @file GeneratorFramePool.h
+ * @brief Thread-local pool used to recycle the coroutine frames of short-lived generators.
+ *
+ * @author Retro & Chill
+ * https://github.com/retroandchill
+ */
+#pragma once
+
+#if !RETROLIB_WITH_MODULES
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#endif
+
+#ifndef RETROLIB_EXPORT
+#define RETROLIB_EXPORT
+#endif
+
+/**
+ * When enabled, generators that are not given an explicit allocator obtain their coroutine frames from the
+ * FGeneratorFramePool instead of the global operator new.
+ */
+#ifndef RETROLIB_WITH_POOLED_GENERATOR_FRAMES
+#define RETROLIB_WITH_POOLED_GENERATOR_FRAMES 0
+#endif
+
+namespace Retro {
+    /**
+     * Counters describing how well the frame pool of the calling thread is being utilized.
+     */
+    RETROLIB_EXPORT struct FGeneratorFramePoolStats {
+        /**
+         * The number of frames that were served from the pool.
+         */
+        size_t Hits = 0;
+
+        /**
+         * The number of frames that had to be allocated with the global operator new, including oversized frames.
+         */
+        size_t Misses = 0;
+
+        /**
+         * The number of frames that were too large to ever be pooled.
+         */
+        size_t Oversized = 0;
+
+        /**
+         * The number of frames currently held by the pool waiting to be reused.
+         */
+        size_t CachedFrames = 0;
+    };
+
+    /**
+     * @class FGeneratorFramePool
+     *
+     * @brief A thread-local pool of coroutine frames, bucketed into size classes.
+     *
+     * When a frame is released it is kept on the free list of its size class instead of being returned to the global
+     * heap, so creating a generator with the same body again only needs to pop a free list. Each frame is allocated
+     * individually from the global operator new, which means that a frame may be released on a different thread than
+     * it was allocated on, in which case it simply joins the pool of the releasing thread.
+     */
+    RETROLIB_EXPORT class FGeneratorFramePool {
+      public:
+        /**
+         * The granularity of the size classes. Frame sizes are rounded up to a multiple of this value.
+         */
+        static constexpr size_t SIZE_CLASS_GRANULARITY = 64;
+
+        /**
+         * The number of size classes that are pooled.
+         */
+        static constexpr size_t NUM_SIZE_CLASSES = 16;
+
+        /**
+         * The largest frame that can be pooled. Larger frames always go to the global operator new.
+         */
+        static constexpr size_t MAX_POOLED_FRAME_SIZE = SIZE_CLASS_GRANULARITY * NUM_SIZE_CLASSES;
+
+        /**
+         * The maximum number of released frames that are kept in each size class.
+         */
+        static constexpr size_t MAX_CACHED_FRAMES_PER_CLASS = 64;
+
+        /**
+         * Obtains the memory for a coroutine frame.
+         *
+         * @param Size The size of the frame
+         * @return The memory for the frame
+         */
+        static void *Allocate(size_t Size) {
+            auto &State = GetState();
+            if (Size > MAX_POOLED_FRAME_SIZE) {
+                State.Stats.Misses++;
+                State.Stats.Oversized++;
+                return ::operator new(Size);
+            }
+
+            auto SizeClass = GetSizeClass(Size);
+            if (auto Frame = State.FreeLists[SizeClass]; Frame != nullptr) {
+                State.FreeLists[SizeClass] = Frame->Next;
+                State.CachedCounts[SizeClass]--;
+                State.Stats.Hits++;
+                State.Stats.CachedFrames--;
+                return Frame;
+            }
+
+            State.Stats.Misses++;
+            return ::operator new(GetSizeClassSize(SizeClass));
+        }
+
+        /**
+         * Releases the memory of a coroutine frame back into the pool.
+         *
+         * @param Ptr The frame to release
+         * @param Size The size of the frame, which must match the size it was allocated with
+         */
+        static void Deallocate(void *Ptr, size_t Size) noexcept {
+            if (Size > MAX_POOLED_FRAME_SIZE) {
+                ::operator delete(Ptr, Size);
+                return;
+            }
+
+            auto &State = GetState();
+            auto SizeClass = GetSizeClass(Size);
+            if (State.bShutDown || State.CachedCounts[SizeClass] == MAX_CACHED_FRAMES_PER_CLASS) {
+                ::operator delete(Ptr, GetSizeClassSize(SizeClass));
+                return;
+            }
+
+            // The guard is only needed once the thread holds onto memory that must be released on exit
+            thread_local FShutdownGuard Guard;
+            State.FreeLists[SizeClass] = ::new (Ptr) FFreeFrame{State.FreeLists[SizeClass]};
+            State.CachedCounts[SizeClass]++;
+            State.Stats.CachedFrames++;
+        }
+
+        /**
+         * Gets the statistics for the pool of the calling thread.
+         *
+         * @return The statistics for the pool
+         */
+        static FGeneratorFramePoolStats GetStats() noexcept {
+            return GetState().Stats;
+        }
+
+        /**
+         * Resets the hit and miss counters for the pool of the calling thread.
+         */
+        static void ResetStats() noexcept {
+            auto &Stats = GetState().Stats;
+            Stats.Hits = 0;
+            Stats.Misses = 0;
+            Stats.Oversized = 0;
+        }
+
+        /**
+         * Returns every frame cached by the pool of the calling thread to the global heap.
+         */
+        static void Trim() noexcept {
+            auto &State = GetState();
+            for (size_t i = 0; i < NUM_SIZE_CLASSES; i++) {
+                while (auto Frame = State.FreeLists[i]) {
+                    State.FreeLists[i] = Frame->Next;
+                    ::operator delete(static_cast<void *>(Frame), GetSizeClassSize(i));
+                }
+                State.CachedCounts[i] = 0;
+            }
+            State.Stats.CachedFrames = 0;
+        }
+
+      private:
+        struct FFreeFrame {
+            FFreeFrame *Next;
+        };
+
+        // Kept trivially destructible so that generators destroyed late in thread shutdown can still reach it
+        struct FState {
+            std::array<FFreeFrame *, NUM_SIZE_CLASSES> FreeLists = {};
+            std::array<size_t, NUM_SIZE_CLASSES> CachedCounts = {};
+            FGeneratorFramePoolStats Stats;
+            bool bShutDown = false;
+        };
+
+        struct FShutdownGuard {
+            ~FShutdownGuard() {
+                Trim();
+                GetState().bShutDown = true;
+            }
+        };
+
+        static_assert(std::is_trivially_destructible_v<FState>);
+
+        static FState &GetState() noexcept {
+            thread_local FState State;
+            return State;
+        }
+
+        static constexpr size_t GetSizeClass(size_t Size) noexcept {
+            return Size == 0 ? 0 : (Size - 1) / SIZE_CLASS_GRANULARITY;
+        }
+
+        static constexpr size_t GetSizeClassSize(size_t SizeClass) noexcept {
+            return (SizeClass + 1) * SIZE_CLASS_GRANULARITY;
+        }
+    };
+
+    /**
+     * A stateless allocator that obtains its memory from the FGeneratorFramePool. Using this as the allocator of a
+     * TGenerator makes its coroutine frame come from the pool.
+     *
+     * @tparam T The type of value to allocate
+     */
+    RETROLIB_EXPORT template <typename T>
+    struct TGeneratorFrameAllocator {
+        static_assert(alignof(T) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__,
+                      "The frame pool only provides the default alignment of operator new");
+
+        using value_type = T;
+        using is_always_equal = std::true_type;
+
+        constexpr TGeneratorFrameAllocator() noexcept = default;
+
+        template <typename U>
+        explicit(false) constexpr TGeneratorFrameAllocator(const TGeneratorFrameAllocator<U> &) noexcept {
+        }
+
+        T *allocate(size_t Count) {
+            return static_cast<T *>(FGeneratorFramePool::Allocate(Count * sizeof(T)));
+        }
+
+        void deallocate(T *Ptr, size_t Count) noexcept {
+            FGeneratorFramePool::Deallocate(Ptr, Count * sizeof(T));
+        }
+
+        template <typename U>
+        constexpr bool operator==(const TGeneratorFrameAllocator<U> &) const noexcept {
+            return true;
+        }
+    };
+
+    /**
+     * The allocator used for the frames of generators that are not given an explicit allocator.
+     */
+#if RETROLIB_WITH_POOLED_GENERATOR_FRAMES
+    RETROLIB_EXPORT using FDefaultGeneratorFrameAllocator = TGeneratorFrameAllocator<std::byte>;
+#else
+    RETROLIB_EXPORT using FDefaultGeneratorFrameAllocator = std::allocator<std::byte>;
+#endif
+} // namespace retro
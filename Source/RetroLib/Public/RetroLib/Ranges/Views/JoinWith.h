@@ -10,10 +10,9 @@
 #include "RetroLib/Functional/ExtensionMethods.h"
 #include "RetroLib/Ranges/Concepts/Concatable.h"
 #include "RetroLib/Ranges/RangeBasics.h"
-
-#if !RETROLIB_WITH_MODULES
-#include <variant>
-#endif
+#include "RetroLib/Ranges/Segments.h"
+#include "RetroLib/Ranges/SizeHint.h"
+#include "RetroLib/Utils/TaggedUnion.h"
 
 #ifndef RETROLIB_EXPORT
 #define RETROLIB_EXPORT
@@ -28,10 +27,6 @@ namespace Retro::Ranges {
         constexpr auto &&UpdateInner(O &&It) {
             return Inner.EmplaceDeref(It);
         }
-
-        constexpr I &GetInner(auto) {
-            return *Inner;
-        }
     };
 
     struct FPassThroughInner {
@@ -39,11 +34,6 @@ namespace Retro::Ranges {
         static constexpr auto &&UpdateInner(O &&It) noexcept(noexcept(*std::forward<O>(It))) {
             return *std::forward<O>(It);
         }
-
-        template <typename O>
-        static constexpr decltype(auto) GetInner(O &&It) {
-            return *std::forward<O>(It);
-        }
     };
 
     template <std::ranges::input_range R>
@@ -86,8 +76,7 @@ namespace Retro::Ranges {
             constexpr explicit FIterator(TJoinWithView &Range)
                 : Range(&Range), OuterIt(std::ranges::begin(Range.Outer)) {
                 if (OuterIt != std::ranges::end(Range.Outer)) {
-                    auto &&Inner = Range.UpdateInner(OuterIt);
-                    Current.template emplace<1>(std::ranges::begin(Inner));
+                    EnterInner(Range.UpdateInner(OuterIt));
                     Satisfy();
                 }
             }
@@ -97,17 +86,19 @@ namespace Retro::Ranges {
             }
 
             constexpr FIterator &operator++() {
-                if (Current.index() == 0) {
-                    auto &It = std::get<0>(Current);
+                // Most steps stay within the current range, so Satisfy is only needed once its end is reached
+                if (Current.GetIndex() == 0) {
+                    auto &It = Current.template Get<0>();
                     RETROLIB_ASSERT(It != std::ranges::end(Range->Contraction));
-                    ++It;
+                    if (++It != std::ranges::end(Range->Contraction)) {
+                        return *this;
+                    }
                 } else {
-                    auto &It = std::get<1>(Current);
-#ifndef NDEBUG
-                    auto &&Inner = Range->GetInner(OuterIt);
-                    RETROLIB_ASSERT(It != std::ranges::end(Inner));
-#endif
-                    ++It;
+                    auto &It = Current.template Get<1>();
+                    RETROLIB_ASSERT(It != InnerEnd);
+                    if (++It != InnerEnd) {
+                        return *this;
+                    }
                 }
                 Satisfy();
                 return *this;
@@ -118,33 +109,42 @@ namespace Retro::Ranges {
             }
 
             constexpr reference operator*() const & {
-                if (Current.index() == 0) {
-                    return *std::get<0>(Current);
+                if constexpr (IteratorUnion::bSharedAlternative) {
+                    return *Current.GetShared();
+                } else if (Current.GetIndex() == 0) {
+                    return *Current.template Get<0>();
                 }
 
-                return *std::get<1>(Current);
+                return *Current.template Get<1>();
             }
 
             constexpr rvalue_reference operator*() && {
-                if (Current.index() == 0) {
-                    return std::move(*std::get<0>(Current));
+                if constexpr (IteratorUnion::bSharedAlternative) {
+                    return std::move(*Current.GetShared());
+                } else if (Current.GetIndex() == 0) {
+                    return std::move(*Current.template Get<0>());
                 }
 
-                return std::move(*std::get<1>(Current));
+                return std::move(*Current.template Get<1>());
             }
 
           private:
+            template <typename I>
+            constexpr void EnterInner(I &&Inner) {
+                Current.template Emplace<1>(std::ranges::begin(Inner));
+                InnerEnd = std::ranges::end(Inner);
+            }
+
             void Satisfy() {
                 while (true) {
-                    if (Current.index() == 0) {
-                        if (std::get<0>(Current) != std::ranges::end(Range->Contraction)) {
+                    if (Current.GetIndex() == 0) {
+                        if (Current.template Get<0>() != std::ranges::end(Range->Contraction)) {
                             break;
                         }
 
-                        auto &&Inner = Range->UpdateInner(OuterIt);
-                        Current.template emplace<1>(std::ranges::begin(Inner));
+                        EnterInner(Range->UpdateInner(OuterIt));
                     } else {
-                        if (auto &&Inner = Range->GetInner(OuterIt); std::get<1>(Current) != std::ranges::end(Inner)) {
+                        if (Current.template Get<1>() != InnerEnd) {
                             break;
                         }
 
@@ -153,14 +153,24 @@ namespace Retro::Ranges {
                             break;
                         }
 
-                        Current.template emplace<0>(std::ranges::begin(Range->Contraction));
+                        Current.template Emplace<0>(std::ranges::begin(Range->Contraction));
                     }
                 }
             }
 
+            /**
+             * Holds either the iterator into the separator or the iterator into the current inner range. When the two
+             * have the same type only one iterator is stored, and stepping through elements does not need to check
+             * which of the two is active.
+             */
+            using IteratorUnion = TTaggedUnion<std::ranges::iterator_t<P>, std::ranges::iterator_t<InnerType>>;
+
             TJoinWithView *Range = nullptr;
             std::ranges::iterator_t<R> OuterIt;
-            std::variant<std::ranges::iterator_t<P>, std::ranges::iterator_t<InnerType>> Current;
+            IteratorUnion Current;
+
+            // The end of the current inner range, so that stepping within it does not dereference the outer iterator
+            std::ranges::sentinel_t<InnerType> InnerEnd;
         };
 
       public:
@@ -252,13 +262,81 @@ namespace Retro::Ranges {
             requires std::ranges::sized_range<OuterType> && std::ranges::sized_range<InnerType> &&
                      std::ranges::sized_range<P> && std::ranges::forward_range<OuterType>
         {
-            SizeType size = (std::ranges::size(Outer) - 1) * std::ranges::size(Contraction);
+            auto OuterSize = std::ranges::size(Outer);
+            if (OuterSize == 0) {
+                return 0;
+            }
+
+            SizeType size = (OuterSize - 1) * std::ranges::size(Contraction);
             for (auto &&it : Outer) {
                 size += std::ranges::size(std::forward<decltype(it)>(it));
             }
             return size;
         }
 
+        /**
+         * @brief Computes the bounds on the number of elements of the joined range.
+         *
+         * If the outer range is a multi-pass range of ranges stored elsewhere, it is traversed once to add up the
+         * bounds of each inner range and each separator, which is cheap compared to producing the joined elements.
+         * Otherwise nothing is known about the size of the joined range.
+         *
+         * @return The bounds on the number of elements in the view.
+         */
+        constexpr FSizeHint SizeHint() {
+            if constexpr (std::ranges::forward_range<OuterType> &&
+                          std::is_reference_v<std::ranges::range_reference_t<OuterType>>) {
+                auto Result = FSizeHint::Exact(0);
+                size_t Count = 0;
+                for (auto &Inner : Outer) {
+                    Result = Result + Retro::Ranges::SizeHint(Inner);
+                    Count++;
+                }
+
+                if (Count > 0) {
+                    Result = Result + Retro::Ranges::SizeHint(Contraction) * (Count - 1);
+                }
+                return Result;
+            } else {
+                return FSizeHint{};
+            }
+        }
+
+        /**
+         * @brief Invokes a functor on each inner range and on the separator between each pair of them, in order,
+         * stopping early if it returns false.
+         *
+         * This lets algorithms handle each piece with a separate loop. Collecting the view into a string reserves the
+         * exact size up front and then appends each piece with a bulk copy, instead of appending one character at a
+         * time through the iterator of this view.
+         *
+         * @param Functor The functor to invoke on each piece
+         * @return Were all the pieces visited
+         */
+        template <typename F>
+        constexpr bool ForEachSegment(F &&Functor) {
+            auto OuterIt = std::ranges::begin(Outer);
+            auto OuterEnd = std::ranges::end(Outer);
+            if (OuterIt == OuterEnd) {
+                return true;
+            }
+
+            while (true) {
+                auto &&Inner = *OuterIt;
+                if (!Retro::Ranges::ForEachSegment(Inner, Functor)) {
+                    return false;
+                }
+
+                if (++OuterIt == OuterEnd) {
+                    return true;
+                }
+
+                if (!Retro::Ranges::ForEachSegment(Contraction, Functor)) {
+                    return false;
+                }
+            }
+        }
+
       private:
         OuterType Outer;
         std::ranges::views::all_t<P> Contraction;
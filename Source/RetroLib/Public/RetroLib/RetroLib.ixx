@@ -12,6 +12,13 @@ module;
 #include <bit>
 #include <cassert>
 
+#if defined(__x86_64__) || defined(_M_X64)
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+#endif
+
 export module RetroLib;
 
 import std;
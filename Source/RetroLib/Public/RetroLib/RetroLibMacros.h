@@ -35,6 +35,12 @@
 #define RETROLIB_ASSERT(...) assert(__VA_ARGS__)
 #endif
 
+#if defined(_MSC_VER) && !defined(__clang__)
+#define RETROLIB_NO_UNIQUE_ADDRESS [[msvc::no_unique_address]]
+#else
+#define RETROLIB_NO_UNIQUE_ADDRESS [[no_unique_address]]
+#endif
+
 #define RETROLIB_FUNCTIONAL_EXTENSION(Exporter, Method, Name) \
   constexpr auto Invoker_##Name##_Method_Variable = Method; \
   template <auto Functor = DynamicFunctor> \
@@ -115,4 +115,23 @@ namespace Retro {
     template <bool Condition, typename T>
     using TMaybeConst = std::conditional_t<Condition, const T, T>;
 
+    /**
+     * Trait for a type that can be relocated by copying its bytes to a new location and then forgetting about the
+     * original object, without running its move constructor or destructor. This holds for all trivially copyable
+     * types, and can be specialized to opt in other types, such as those that only hold owning pointers.
+     *
+     * @tparam T The type to check
+     */
+    RETROLIB_EXPORT template <typename T>
+    struct TIsTriviallyRelocatable : std::bool_constant<std::is_trivially_copyable_v<T>> {};
+
+    /**
+     * Checks if a type is trivially relocatable.
+     *
+     * @tparam T The type to check
+     * @see TIsTriviallyRelocatable
+     */
+    RETROLIB_EXPORT template <typename T>
+    constexpr bool IsTriviallyRelocatable = TIsTriviallyRelocatable<T>::value;
+
 } // namespace retro
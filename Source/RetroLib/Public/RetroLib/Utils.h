@@ -2,10 +2,14 @@
 
 #pragma once
 
+#include "RetroLib/Utils/FlatMap.h"
 #include "RetroLib/Utils/ForwardLike.h"
 #include "RetroLib/Utils/NonPropagatingCache.h"
 #include "RetroLib/Utils/Operators.h"
 #include "RetroLib/Utils/Polymorphic.h"
+#include "RetroLib/Utils/PolymorphicVector.h"
+#include "RetroLib/Utils/StaticVector.h"
+#include "RetroLib/Utils/TaggedUnion.h"
 #include "RetroLib/Utils/Tuple.h"
 #include "RetroLib/Utils/UniqueAny.h"
 #include "RetroLib/Utils/Unreachable.h"
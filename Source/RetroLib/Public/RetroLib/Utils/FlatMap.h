@@ -0,0 +1,303 @@
+/**
+ * @file FlatMap.h
+ * @brief Contains the declaration for a map that stores its entries in a sorted contiguous array.
+ *
+ * @author Retro & Chill
+ * https://github.com/retroandchill
+ */
+#pragma once
+
+#include "RetroLib/Ranges/Concepts/Containers.h"
+#include "RetroLib/RetroLibMacros.h"
+
+#if !RETROLIB_WITH_MODULES
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <ranges>
+#include <span>
+#include <utility>
+#include <vector>
+#endif
+
+#ifndef RETROLIB_EXPORT
+#define RETROLIB_EXPORT
+#endif
+
+namespace Retro {
+    /**
+     * @brief An associative container that keeps its entries sorted by key in a single contiguous array.
+     *
+     * Lookups are a binary search over contiguous memory, and building the map from a range only needs to append the
+     * entries and sort them once, which makes it a good fit for lookup tables that are built in bulk and then only
+     * read. Inserting a single entry is linear in the size of the map, so prefer InsertRange when adding many.
+     *
+     * When several entries share the same key, the first one that was inserted is kept, matching the behavior of
+     * `std::map`.
+     *
+     * @tparam K The type of the keys
+     * @tparam V The type of the values
+     * @tparam Compare The comparison used to order the keys
+     * @tparam Allocator The allocator used to obtain the storage for the entries
+     */
+    RETROLIB_EXPORT template <typename K, typename V, typename Compare = std::less<K>,
+                              typename Allocator = std::allocator<std::pair<K, V>>>
+    class TFlatMap {
+      public:
+        using key_type = K;
+        using mapped_type = V;
+        using value_type = std::pair<K, V>;
+        using key_compare = Compare;
+        using ConstIterator = typename std::vector<value_type, Allocator>::const_iterator;
+
+        TFlatMap() = default;
+
+        /**
+         * Creates an empty map that uses the given comparison to order its keys.
+         *
+         * @param Comp The comparison used to order the keys
+         */
+        explicit TFlatMap(const Compare &Comp) : Comp(Comp) {
+        }
+
+        /**
+         * Finds the value associated with the given key.
+         *
+         * @param Key The key to look up
+         * @return A pointer to the value, or nullptr if the key is not in the map
+         */
+        V *Find(const K &Key) {
+            auto It = LowerBound(Key);
+            return It != Data.end() && !Comp(Key, It->first) ? &It->second : nullptr;
+        }
+
+        /**
+         * Finds the value associated with the given key.
+         *
+         * @param Key The key to look up
+         * @return A pointer to the value, or nullptr if the key is not in the map
+         */
+        const V *Find(const K &Key) const {
+            auto It = LowerBound(Key);
+            return It != Data.end() && !Comp(Key, It->first) ? &It->second : nullptr;
+        }
+
+        /**
+         * Checks if the given key is in the map.
+         *
+         * @param Key The key to look up
+         * @return Is the key in the map
+         */
+        bool Contains(const K &Key) const {
+            return Find(Key) != nullptr;
+        }
+
+        /**
+         * Adds an entry to the map if its key is not already present. This is linear in the size of the map.
+         *
+         * @param Args The arguments used to construct the entry
+         * @return Was the entry added to the map
+         */
+        template <typename... A>
+            requires std::constructible_from<value_type, A...>
+        bool TryEmplace(A &&...Args) {
+            value_type Entry(std::forward<A>(Args)...);
+            auto It = LowerBound(Entry.first);
+            if (It != Data.end() && !Comp(Entry.first, It->first)) {
+                return false;
+            }
+
+            Data.insert(It, std::move(Entry));
+            return true;
+        }
+
+        /**
+         * Adds every entry of the range to the map. The new entries are gathered into a separate buffer and sorted as a
+         * block, then merged with the existing entries, so the whole operation only sorts once. If reading the range or
+         * comparing the keys throws, the map is left unchanged, and the range may safely read from the map itself.
+         *
+         * @param Range The range of entries to add
+         */
+        template <std::ranges::input_range R>
+            requires std::constructible_from<value_type, std::ranges::range_reference_t<R>>
+        void InsertRange(R &&Range) {
+            if (Data.empty()) {
+                // With nothing to merge with, the entries can be built in the existing storage, which only has to be
+                // emptied again if something throws
+                try {
+                    AppendSorted(Data, std::forward<R>(Range));
+                    Data.erase(std::unique(Data.begin(), Data.end(), GetKeyEquals()), Data.end());
+                } catch (...) {
+                    Data.clear();
+                    throw;
+                }
+            } else {
+                std::vector<value_type, Allocator> Entries(Data.get_allocator());
+                AppendSorted(Entries, std::forward<R>(Range));
+
+                std::vector<value_type, Allocator> Merged(Data.get_allocator());
+                Merged.reserve(Data.size() + Entries.size());
+                auto Append = [this, &Merged](auto &&Entry) {
+                    if (Merged.empty() || Comp(Merged.back().first, Entry.first)) {
+                        Merged.emplace_back(std::forward<decltype(Entry)>(Entry));
+                    }
+                };
+
+                // Existing entries go first when the keys are equal, so the oldest entry with each key is kept. They
+                // are only moved out of when that can't throw, so that the map is intact until the final swap.
+                auto Existing = Data.begin();
+                auto New = Entries.begin();
+                while (Existing != Data.end() || New != Entries.end()) {
+                    if (New == Entries.end() || (Existing != Data.end() && !Comp(New->first, Existing->first))) {
+                        Append(std::move_if_noexcept(*Existing++));
+                    } else {
+                        Append(std::move(*New++));
+                    }
+                }
+                Data.swap(Merged);
+            }
+        }
+
+        /**
+         * Reserves storage for at least the specified number of entries.
+         *
+         * @param Capacity The number of entries to reserve storage for
+         */
+        void Reserve(size_t Capacity) {
+            Data.reserve(Capacity);
+        }
+
+        /**
+         * Gets the number of entries the map can hold without reallocating.
+         *
+         * @return The capacity of the map
+         */
+        size_t GetCapacity() const noexcept {
+            return Data.capacity();
+        }
+
+        /**
+         * Removes every entry from the map, keeping its storage.
+         */
+        void Clear() noexcept {
+            Data.clear();
+        }
+
+        /**
+         * Gets the entries of the map, sorted by key.
+         *
+         * @return A view of the entries
+         */
+        std::span<const value_type> GetData() const noexcept {
+            return Data;
+        }
+
+        ConstIterator begin() const noexcept {
+            return Data.begin();
+        }
+
+        ConstIterator end() const noexcept {
+            return Data.end();
+        }
+
+        size_t size() const noexcept {
+            return Data.size();
+        }
+
+        bool empty() const noexcept {
+            return Data.empty();
+        }
+
+        bool operator==(const TFlatMap &Other) const {
+            return Data == Other.Data;
+        }
+
+      private:
+        auto GetKeyEquals() const {
+            return [this](const value_type &Lhs, const value_type &Rhs) { return !Comp(Lhs.first, Rhs.first); };
+        }
+
+        /**
+         * Appends the entries of the range to the end of the given buffer, then stably sorts the appended block by key.
+         *
+         * @param Buffer The buffer to append to
+         * @param Range The range of entries to append
+         */
+        template <typename R>
+        void AppendSorted(std::vector<value_type, Allocator> &Buffer, R &&Range) {
+            auto OldSize = static_cast<std::ptrdiff_t>(Buffer.size());
+            if constexpr (std::ranges::sized_range<R>) {
+                Buffer.reserve(Buffer.size() + std::ranges::size(Range));
+            }
+
+            for (auto &&Entry : Range) {
+                Buffer.emplace_back(std::forward<decltype(Entry)>(Entry));
+            }
+
+            auto ByKey = [this](const value_type &Lhs, const value_type &Rhs) { return Comp(Lhs.first, Rhs.first); };
+            auto Middle = Buffer.begin() + OldSize;
+            // Input that is already ordered, such as an enumerated range, does not need to be sorted at all
+            if (!std::is_sorted(Middle, Buffer.end(), ByKey)) {
+                std::stable_sort(Middle, Buffer.end(), ByKey);
+            }
+        }
+
+        auto LowerBound(const K &Key) {
+            return std::ranges::lower_bound(Data, Key, Comp, &value_type::first);
+        }
+
+        auto LowerBound(const K &Key) const {
+            return std::ranges::lower_bound(Data, Key, Comp, &value_type::first);
+        }
+
+        std::vector<value_type, Allocator> Data;
+        RETROLIB_NO_UNIQUE_ADDRESS Compare Comp;
+    };
+} // namespace Retro
+
+namespace Retro::Ranges {
+    RETROLIB_EXPORT template <>
+    struct TIsMap<TFlatMap> : std::true_type {};
+
+    template <typename K, typename V, typename C, typename A>
+    struct TAppendableContainerType<TFlatMap<K, V, C, A>> : FValidType {
+        template <typename T>
+            requires std::constructible_from<std::pair<K, V>, T>
+        static bool Append(TFlatMap<K, V, C, A> &Container, T &&Value) {
+            return Container.TryEmplace(std::forward<T>(Value));
+        }
+    };
+
+    template <typename K, typename V, typename C, typename A>
+    struct TRangeAppendableContainerType<TFlatMap<K, V, C, A>> : FValidType {
+        template <std::ranges::input_range R>
+            requires std::constructible_from<std::pair<K, V>, std::ranges::range_reference_t<R>>
+        static void AppendRange(TFlatMap<K, V, C, A> &Container, R &&Range) {
+            Container.InsertRange(std::forward<R>(Range));
+        }
+    };
+
+    template <typename K, typename V, typename C, typename A>
+    struct TReservableContainerType<TFlatMap<K, V, C, A>> : FValidType {
+        static void Reserve(TFlatMap<K, V, C, A> &Container, size_t Size) {
+            Container.Reserve(Size);
+        }
+
+        static size_t Capacity(const TFlatMap<K, V, C, A> &Container) {
+            return Container.GetCapacity();
+        }
+
+        static size_t MaxSize(const TFlatMap<K, V, C, A> &) {
+            return static_cast<size_t>(std::numeric_limits<std::ptrdiff_t>::max()) / sizeof(std::pair<K, V>);
+        }
+    };
+
+    template <typename K, typename V, typename C, typename A>
+    struct TClearableContainerType<TFlatMap<K, V, C, A>> : FValidType {
+        static void Clear(TFlatMap<K, V, C, A> &Container) {
+            Container.Clear();
+        }
+    };
+} // namespace Retro::Ranges
@@ -351,4 +351,62 @@ namespace Retro {
      * This variable provides a convenient way to use the FModulo class for the modulo operation of two values.
      */
     RETROLIB_EXPORT constexpr FModuloFunction Modulo;
+
+    /**
+     * @brief Represents an operation that selects the smaller of two values.
+     *
+     * This class follows the semantics of `std::min`, returning the left-hand side when the two values are
+     * equivalent.
+     */
+    struct FMinFunction {
+        /**
+         * Select the smaller of the target values.
+         *
+         * @tparam T The type of the values
+         * @param Lhs The left-hand side value
+         * @param Rhs The right-hand side value
+         * @return The smaller of the two values
+         */
+        template <typename T>
+            requires LessThanComparable<T>
+        constexpr const T &operator()(const T &Lhs, const T &Rhs) const {
+            return Rhs < Lhs ? Rhs : Lhs;
+        }
+    };
+
+    /**
+     * @brief An instance of the FMinFunction class used to select the smaller of two values.
+     *
+     * Reducing a range with this functor yields the smallest element of the range.
+     */
+    RETROLIB_EXPORT constexpr FMinFunction Min;
+
+    /**
+     * @brief Represents an operation that selects the larger of two values.
+     *
+     * This class follows the semantics of `std::max`, returning the left-hand side when the two values are
+     * equivalent.
+     */
+    struct FMaxFunction {
+        /**
+         * Select the larger of the target values.
+         *
+         * @tparam T The type of the values
+         * @param Lhs The left-hand side value
+         * @param Rhs The right-hand side value
+         * @return The larger of the two values
+         */
+        template <typename T>
+            requires LessThanComparable<T>
+        constexpr const T &operator()(const T &Lhs, const T &Rhs) const {
+            return Lhs < Rhs ? Rhs : Lhs;
+        }
+    };
+
+    /**
+     * @brief An instance of the FMaxFunction class used to select the larger of two values.
+     *
+     * Reducing a range with this functor yields the largest element of the range.
+     */
+    RETROLIB_EXPORT constexpr FMaxFunction Max;
 } // namespace retro
\ No newline at end of file
@@ -10,10 +10,15 @@
 #include "RetroLib/Concepts/Inheritance.h"
 #include "RetroLib/Concepts/OpaqueStorage.h"
 #include "RetroLib/Optionals/OptionalOperations.h"
+#include "RetroLib/TypeTraits.h"
 
 #if !RETROLIB_WITH_MODULES
 #include <array>
+#include <atomic>
 #include <bit>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
 #include <typeinfo>
 #include <utility>
 #endif
@@ -23,6 +28,22 @@
 #endif
 
 namespace Retro {
+    /**
+     * Determines how a polymorphic value copies a derived type that is too large for its small storage.
+     */
+    RETROLIB_EXPORT enum class EPolymorphicCopyPolicy : std::uint8_t {
+        /**
+         * Every copy of the polymorphic value allocates and copies its own instance of the derived type.
+         */
+        DeepCopy,
+
+        /**
+         * Copies share a reference counted instance of the derived type, which is only cloned the first time a copy
+         * is accessed mutably while still being shared.
+         */
+        CopyOnWrite
+    };
+
     /**
      * @brief A class template that provides polymorphic storage and access capabilities for types derived from a base
      * class.
@@ -31,15 +52,30 @@ namespace Retro {
      * polymorphic behavior. It provides interfaces to manage the lifetime and access the stored object polymorphically.
      *
      * @tparam T The base class type which all stored objects must derive from. Must satisfy the ClassType concept.
+     * @tparam SmallStorageSize The size of the inline buffer used to store derived types without allocating.
+     * @tparam Allocator The allocator used to obtain memory for derived types that do not fit in the inline buffer. The
+     *                   allocator is stored alongside the value, and follows the same propagation rules as it would
+     *                   in a standard container when the polymorphic value is copied, moved or assigned.
+     * @tparam CopyPolicy How derived types that do not fit in the inline buffer are copied. With copy-on-write,
+     *                    copying is O(1) and only the non-const accessors (Get, operator-> and operator*) may clone
+     *                    the value, so read-only access should go through a const reference.
      */
-    RETROLIB_EXPORT template <Class T, size_t SmallStorageSize = DEFAULT_SMALL_STORAGE_SIZE>
+    RETROLIB_EXPORT template <Class T, size_t SmallStorageSize = DEFAULT_SMALL_STORAGE_SIZE,
+                              typename Allocator = std::allocator<std::byte>,
+                              EPolymorphicCopyPolicy CopyPolicy = EPolymorphicCopyPolicy::DeepCopy>
         requires(SmallStorageSize >= sizeof(void *))
     class TPolymorphic {
+      public:
+        /**
+         * Checks if a derived type can be stored inline in the small buffer. Types that do not fit are allocated
+         * using the allocator instead.
+         *
+         * @tparam U The derived type to check
+         */
         template <typename U>
             requires std::derived_from<U, T>
-        static constexpr bool FitsSmallStorage = sizeof(U) <= SmallStorageSize;
+        static constexpr bool FitsSmallStorage = sizeof(U) <= SmallStorageSize && alignof(U) <= alignof(void *);
 
-      public:
 #ifdef __UNREAL__
         constexpr static bool bHasIntrusiveUnsetOptionalState = true;
         using IntrusiveUnsetOptionalStateType = TPolymorphic;
@@ -62,7 +98,18 @@ namespace Retro {
         constexpr TPolymorphic() noexcept
             requires std::is_default_constructible_v<T>
         {
-            Storage.template Emplace<T>();
+            Storage.template Emplace<T>(Alloc);
+        }
+
+        /**
+         * Constructs a default instance of T using the given allocator.
+         *
+         * @param Alloc The allocator to use if the value does not fit in the small storage
+         */
+        constexpr TPolymorphic(std::allocator_arg_t, const Allocator &Alloc) noexcept
+            requires std::is_default_constructible_v<T>
+            : Vtable(GetVtable<T>()), Alloc(Alloc) {
+            Storage.template Emplace<T>(this->Alloc);
         }
 
         /**
@@ -85,8 +132,22 @@ namespace Retro {
          */
         template <typename U>
             requires std::derived_from<std::decay_t<U>, T>
-        explicit(false) constexpr TPolymorphic(U &&Value) noexcept : Vtable(GetVtable<U>()) {
-            Storage.template Emplace<std::decay_t<U>>(std::forward<U>(Value));
+        explicit(false) constexpr TPolymorphic(U &&Value) noexcept : Vtable(GetVtable<std::decay_t<U>>()) {
+            Storage.template Emplace<std::decay_t<U>>(Alloc, std::forward<U>(Value));
+        }
+
+        /**
+         * Constructs a Polymorphic object from a value of type U using the given allocator.
+         *
+         * @tparam U The type of the value used to construct the Polymorphic object. It must be a type derived from T.
+         * @param Alloc The allocator to use if the value does not fit in the small storage
+         * @param Value An instance of type U, which will be stored within the Polymorphic object.
+         */
+        template <typename U>
+            requires std::derived_from<std::decay_t<U>, T>
+        constexpr TPolymorphic(std::allocator_arg_t, const Allocator &Alloc, U &&Value) noexcept
+            : Vtable(GetVtable<std::decay_t<U>>()), Alloc(Alloc) {
+            Storage.template Emplace<std::decay_t<U>>(this->Alloc, std::forward<U>(Value));
         }
 
         /**
@@ -114,7 +175,23 @@ namespace Retro {
         template <typename U, typename... A>
             requires std::derived_from<U, T> && std::constructible_from<U, A...>
         explicit constexpr TPolymorphic(std::in_place_type_t<U>, A &&...Args) noexcept : Vtable(GetVtable<U>()) {
-            Storage.template Emplace<U>(std::forward<A>(Args)...);
+            Storage.template Emplace<U>(Alloc, std::forward<A>(Args)...);
+        }
+
+        /**
+         * Constructs a Polymorphic object with an in-place type and arguments, using the given allocator.
+         *
+         * @tparam U The type of object to be constructed within the Polymorphic. It must be a type derived from T.
+         * @tparam A Parameter pack representing the types of the arguments used for constructing the U type object.
+         * @param Alloc The allocator to use if the value does not fit in the small storage
+         * @param Args Arguments to be forwarded to the constructor of U.
+         */
+        template <typename U, typename... A>
+            requires std::derived_from<U, T> && std::constructible_from<U, A...>
+        constexpr TPolymorphic(std::allocator_arg_t, const Allocator &Alloc, std::in_place_type_t<U>,
+                               A &&...Args) noexcept
+            : Vtable(GetVtable<U>()), Alloc(Alloc) {
+            Storage.template Emplace<U>(this->Alloc, std::forward<A>(Args)...);
         }
 
 #ifdef __UNREAL__
@@ -134,11 +211,29 @@ namespace Retro {
          * @post A new Polymorphic object is created with the same polymorphic type and state
          *       as the object provided.
          *
+         * @note The allocator is obtained using `select_on_container_copy_construction`, so for allocators such as
+         *       `std::pmr::polymorphic_allocator` the copy does not share the memory resource of the original. Use the
+         *       allocator-extended copy constructor to copy into a specific resource.
+         *
          * @throws No exceptions are thrown. The constructor is marked noexcept.
          */
-        constexpr TPolymorphic(const TPolymorphic &Other) noexcept : Vtable(Other.Vtable) {
+        constexpr TPolymorphic(const TPolymorphic &Other) noexcept
+            : Vtable(Other.Vtable), Alloc(FAllocatorTraits::select_on_container_copy_construction(Other.Alloc)) {
+            if (Vtable != nullptr) {
+                Vtable->Copy(Other.Storage, Storage, Alloc);
+            }
+        }
+
+        /**
+         * @brief Copies another Polymorphic object, using the given allocator for the copy.
+         *
+         * @param Alloc The allocator to use if the value does not fit in the small storage
+         * @param Other The Polymorphic object to be copied.
+         */
+        constexpr TPolymorphic(std::allocator_arg_t, const Allocator &Alloc, const TPolymorphic &Other) noexcept
+            : Vtable(Other.Vtable), Alloc(Alloc) {
             if (Vtable != nullptr) {
-                Vtable->Copy(Other.Storage, Storage);
+                Vtable->Copy(Other.Storage, Storage, this->Alloc);
             }
         }
 
@@ -159,9 +254,9 @@ namespace Retro {
          *
          * @throws No exceptions are thrown. The constructor is marked noexcept.
          */
-        constexpr TPolymorphic(TPolymorphic &&Other) noexcept : Vtable(Other.Vtable) {
+        constexpr TPolymorphic(TPolymorphic &&Other) noexcept : Vtable(Other.Vtable), Alloc(Other.Alloc) {
             if (Vtable != nullptr) {
-                Vtable->Move(Other.Storage, Storage);
+                Vtable->Move(Other.Storage, Storage, Alloc);
             }
         }
 
@@ -178,7 +273,7 @@ namespace Retro {
          */
         constexpr ~TPolymorphic() noexcept {
             if (Vtable != nullptr) {
-                Vtable->Destroy(Storage);
+                Vtable->Destroy(Storage, Alloc);
             }
         }
 
@@ -189,26 +284,35 @@ namespace Retro {
          * If they are, it assigns the values by invoking a copy assignment operation through the vtable.
          * If the types differ, it destroys the current contents and performs a new copy via the vtable.
          *
+         * If the allocator propagates on copy assignment and the two allocators differ, the current contents are
+         * released using the current allocator before the allocator is replaced.
+         *
          * @param Other The Polymorphic object to be assigned to the current object.
          * @return A reference to the current object after assignment.
          * @note The operation is noexcept, implying it does not throw exceptions.
          */
         constexpr TPolymorphic &operator=(const TPolymorphic &Other) noexcept {
+            if constexpr (FAllocatorTraits::propagate_on_container_copy_assignment::value) {
+                if (Alloc != Other.Alloc) {
+                    Reset();
+                    Alloc = Other.Alloc;
+                }
+            }
+
             if (Vtable == nullptr) {
                 Vtable = Other.Vtable;
                 if (Vtable != nullptr) {
-                    Vtable->Copy(Other.Storage, Storage);
+                    Vtable->Copy(Other.Storage, Storage, Alloc);
                 }
             } else if (Other.Vtable == nullptr) {
-                Vtable->Destroy(Storage);
-                Vtable = nullptr;
+                Reset();
             } else if (Vtable->GetType() == Other.Vtable->GetType()) {
                 Vtable = Other.Vtable;
-                Vtable->CopyAssign(Other.Storage, Storage);
+                Vtable->CopyAssign(Other.Storage, Storage, Alloc);
             } else {
-                Vtable->Destroy(Storage);
+                Vtable->Destroy(Storage, Alloc);
                 Vtable = Other.Vtable;
-                Vtable->Copy(Other.Storage, Storage);
+                Vtable->Copy(Other.Storage, Storage, Alloc);
             }
 
             return *this;
@@ -224,6 +328,14 @@ namespace Retro {
          * If not, it destroys the current resources, assigns the new vtable, and moves the resources
          * from the other object.
          *
+         * If the allocator propagates on move assignment and the two allocators differ, the current contents are
+         * released using the current allocator before the allocator is replaced.
+         *
+         * When both values can be relocated, meaning they are either trivially relocatable and stored inline or are
+         * heap allocated by equal allocators, the two values are swapped by exchanging their storage. This takes the
+         * value from the other object without calling any constructors, and leaves it holding the previous value of
+         * this one.
+         *
          * @param Other A rvalue reference to the Polymorphic instance being assigned from.
          *
          * @return A reference to the current instance after assignment.
@@ -231,21 +343,34 @@ namespace Retro {
          * @note The operation is noexcept, ensuring that it does not throw exceptions.
          */
         constexpr TPolymorphic &operator=(TPolymorphic &&Other) noexcept {
-            if (Vtable == nullptr) {
+            if (this == &Other) {
+                return *this;
+            }
+
+            if constexpr (FAllocatorTraits::propagate_on_container_move_assignment::value) {
+                if (Alloc != Other.Alloc) {
+                    Reset();
+                    Alloc = Other.Alloc;
+                }
+            }
+
+            if (CanRelocate() && Other.CanRelocate() && Alloc == Other.Alloc) {
+                std::swap(Storage, Other.Storage);
+                std::swap(Vtable, Other.Vtable);
+            } else if (Vtable == nullptr) {
                 Vtable = Other.Vtable;
                 if (Vtable != nullptr) {
-                    Vtable->Move(Other.Storage, Storage);
+                    Vtable->Move(Other.Storage, Storage, Alloc);
                 }
             } else if (Other.Vtable == nullptr) {
-                Vtable->Destroy(Storage);
-                Vtable = nullptr;
+                Reset();
             } else if (Vtable->GetType() == Other.Vtable->GetType()) {
                 Vtable = Other.Vtable;
-                Vtable->MoveAssign(Other.Storage, Storage);
+                Vtable->MoveAssign(Other.Storage, Storage, Alloc);
             } else {
-                Vtable->Destroy(Storage);
+                Vtable->Destroy(Storage, Alloc);
                 Vtable = Other.Vtable;
-                Vtable->Move(Other.Storage, Storage);
+                Vtable->Move(Other.Storage, Storage, Alloc);
             }
             return *this;
         }
@@ -282,10 +407,13 @@ namespace Retro {
          * This function accesses the stored value through the virtual table's
          * get_value method, returning a pointer of type T.
          *
+         * @note When using the copy-on-write policy, this will clone the value if it is currently shared with
+         *       another polymorphic value.
+         *
          * @return A pointer to the stored value of type T.
          */
         constexpr T *Get() {
-            return Vtable->GetValue(Storage);
+            return Vtable->GetValue(Storage, Alloc);
         }
 
         /**
@@ -371,13 +499,9 @@ namespace Retro {
         template <typename U, typename... A>
             requires std::derived_from<U, T>
         constexpr void Emplace(A &&...Args) noexcept {
-            Vtable->Destroy(Storage);
+            Reset();
             Vtable = GetVtable<U>();
-            if constexpr (FitsSmallStorage<U>) {
-                new (std::bit_cast<U *>(Storage.SmallStorage.data())) U(std::forward<A>(Args)...);
-            } else {
-                Storage.LargeStorage = new U(std::forward<A>(Args)...);
-            }
+            Storage.template Emplace<U>(Alloc, std::forward<A>(Args)...);
         }
 
         /**
@@ -389,32 +513,103 @@ namespace Retro {
             return Vtable->GetSize();
         }
 
+        /**
+         * Gets the allocator used for values that do not fit in the small storage.
+         *
+         * @return A copy of the allocator
+         */
+        constexpr Allocator GetAllocator() const noexcept {
+            return Alloc;
+        }
+
       private:
+        using FAllocatorTraits = std::allocator_traits<Allocator>;
+
+        template <typename U>
+        using TAllocatorTraits = typename FAllocatorTraits::template rebind_traits<U>;
+
+        template <typename U, typename... A>
+        static constexpr U *AllocateLarge(const Allocator &Alloc, A &&...Args) {
+            typename TAllocatorTraits<U>::allocator_type Rebound(Alloc);
+            U *Ptr = TAllocatorTraits<U>::allocate(Rebound, 1);
+            TAllocatorTraits<U>::construct(Rebound, Ptr, std::forward<A>(Args)...);
+            return Ptr;
+        }
+
+        template <typename U>
+        static constexpr void DeallocateLarge(const Allocator &Alloc, U *Ptr) {
+            typename TAllocatorTraits<U>::allocator_type Rebound(Alloc);
+            TAllocatorTraits<U>::destroy(Rebound, Ptr);
+            TAllocatorTraits<U>::deallocate(Rebound, Ptr, 1);
+        }
+
+        template <typename U>
+        static constexpr bool UsesSharedStorage =
+            CopyPolicy == EPolymorphicCopyPolicy::CopyOnWrite && !FitsSmallStorage<U>;
+
+        /**
+         * The heap block used to hold a derived type under the copy-on-write policy. The block holds onto the
+         * allocator it was created with, as it may end up being released by a different polymorphic value.
+         */
+        template <typename U>
+        struct TSharedValue {
+            template <typename... A>
+            explicit TSharedValue(const Allocator &Alloc, A &&...Args) : Alloc(Alloc), Value(std::forward<A>(Args)...) {
+            }
+
+            std::atomic<size_t> RefCount = 1;
+            RETROLIB_NO_UNIQUE_ADDRESS Allocator Alloc;
+            U Value;
+        };
+
+        template <typename U>
+        static constexpr void ReleaseShared(TSharedValue<U> *Shared) {
+            if (Shared->RefCount.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                Allocator SharedAlloc = Shared->Alloc;
+                DeallocateLarge(SharedAlloc, Shared);
+            }
+        }
+
+        constexpr bool CanRelocate() const noexcept {
+            return Vtable != nullptr && (Vtable->IsTriviallyRelocatable || Vtable->IsLarge);
+        }
+
+        constexpr void Reset() noexcept {
+            if (Vtable != nullptr) {
+                Vtable->Destroy(Storage, Alloc);
+                Vtable = nullptr;
+            }
+        }
+
         union FOpaqueStorage {
             std::array<std::byte, SmallStorageSize> SmallStorage;
             void *LargeStorage;
 
             template <typename U, typename... A>
                 requires std::derived_from<U, T> && std::constructible_from<U, A...>
-            constexpr void Emplace(A &&...Args) noexcept {
+            constexpr void Emplace(const Allocator &Alloc, A &&...Args) noexcept {
                 if constexpr (FitsSmallStorage<U>) {
                     new (std::bit_cast<U *>(SmallStorage.data())) U(std::forward<A>(Args)...);
+                } else if constexpr (UsesSharedStorage<U>) {
+                    LargeStorage = AllocateLarge<TSharedValue<U>>(Alloc, Alloc, std::forward<A>(Args)...);
                 } else {
-                    LargeStorage = new U(std::forward<A>(Args)...);
+                    LargeStorage = AllocateLarge<U>(Alloc, std::forward<A>(Args)...);
                 }
             }
         };
 
         struct FVTable {
+            bool IsLarge;
+            bool IsTriviallyRelocatable;
             const std::type_info &(*GetType)();
             size_t (*GetSize)();
-            T *(*GetValue)(FOpaqueStorage &Storage);
+            T *(*GetValue)(FOpaqueStorage &Storage, const Allocator &Alloc);
             const T *(*GetConstValue)(const FOpaqueStorage &Storage);
-            void (*Destroy)(FOpaqueStorage &Storage);
-            void (*Copy)(const FOpaqueStorage &Src, FOpaqueStorage &Dest);
-            void (*CopyAssign)(const FOpaqueStorage &Src, FOpaqueStorage &Dest);
-            void (*Move)(FOpaqueStorage &Src, FOpaqueStorage &Dest);
-            void (*MoveAssign)(FOpaqueStorage &Src, FOpaqueStorage &Dest);
+            void (*Destroy)(FOpaqueStorage &Storage, const Allocator &Alloc);
+            void (*Copy)(const FOpaqueStorage &Src, FOpaqueStorage &Dest, const Allocator &Alloc);
+            void (*CopyAssign)(const FOpaqueStorage &Src, FOpaqueStorage &Dest, const Allocator &Alloc);
+            void (*Move)(FOpaqueStorage &Src, FOpaqueStorage &Dest, const Allocator &Alloc);
+            void (*MoveAssign)(FOpaqueStorage &Src, FOpaqueStorage &Dest, const Allocator &Alloc);
         };
 
         template <typename U>
@@ -428,9 +623,18 @@ namespace Retro {
                 return sizeof(U);
             }
 
-            static constexpr T *GetValue(FOpaqueStorage &Data) {
+            static constexpr T *GetValue(FOpaqueStorage &Data, const Allocator &Alloc) {
                 if constexpr (FitsSmallStorage<U>) {
                     return std::bit_cast<U *>(Data.SmallStorage.data());
+                } else if constexpr (UsesSharedStorage<U>) {
+                    auto Shared = static_cast<TSharedValue<U> *>(Data.LargeStorage);
+                    if (Shared->RefCount.load(std::memory_order_acquire) != 1) {
+                        auto Unique = AllocateLarge<TSharedValue<U>>(Alloc, Alloc, std::as_const(Shared->Value));
+                        ReleaseShared(Shared);
+                        Data.LargeStorage = Unique;
+                        Shared = Unique;
+                    }
+                    return &Shared->Value;
                 } else {
                     return static_cast<U *>(Data.LargeStorage);
                 }
@@ -439,48 +643,72 @@ namespace Retro {
             static constexpr const T *GetConstValue(const FOpaqueStorage &Data) {
                 if constexpr (FitsSmallStorage<U>) {
                     return std::bit_cast<const U *>(Data.SmallStorage.data());
+                } else if constexpr (UsesSharedStorage<U>) {
+                    return &static_cast<const TSharedValue<U> *>(Data.LargeStorage)->Value;
                 } else {
                     return static_cast<const U *>(Data.LargeStorage);
                 }
             }
 
-            static constexpr void Destroy(FOpaqueStorage &Data) {
+            static constexpr void Destroy(FOpaqueStorage &Data, const Allocator &Alloc) {
                 if constexpr (FitsSmallStorage<U>) {
                     std::bit_cast<const U *>(Data.SmallStorage.data())->~U();
+                } else if constexpr (UsesSharedStorage<U>) {
+                    ReleaseShared(static_cast<TSharedValue<U> *>(Data.LargeStorage));
                 } else {
-                    delete static_cast<const U *>(Data.LargeStorage);
+                    DeallocateLarge(Alloc, static_cast<U *>(Data.LargeStorage));
                 }
             }
 
-            static constexpr void Copy(const FOpaqueStorage &Src, FOpaqueStorage &Dest) {
+            static constexpr void Copy(const FOpaqueStorage &Src, FOpaqueStorage &Dest, const Allocator &Alloc) {
                 if constexpr (FitsSmallStorage<U>) {
-                    Dest.template Emplace<U>(*std::bit_cast<const U *>(Src.SmallStorage.data()));
+                    Dest.template Emplace<U>(Alloc, *std::bit_cast<const U *>(Src.SmallStorage.data()));
+                } else if constexpr (UsesSharedStorage<U>) {
+                    // Only share when the block can be released by our allocator, otherwise the copy could outlive
+                    // the memory it points to (e.g. a value copied out of a per-frame arena)
+                    auto Shared = static_cast<TSharedValue<U> *>(Src.LargeStorage);
+                    if (Shared->Alloc == Alloc) {
+                        Shared->RefCount.fetch_add(1, std::memory_order_relaxed);
+                        Dest.LargeStorage = Shared;
+                    } else {
+                        Dest.template Emplace<U>(Alloc, std::as_const(Shared->Value));
+                    }
                 } else {
-                    Dest.template Emplace<U>(*static_cast<const U *>(Src.LargeStorage));
+                    Dest.template Emplace<U>(Alloc, *static_cast<const U *>(Src.LargeStorage));
                 }
             }
 
-            static constexpr void CopyAssign(const FOpaqueStorage &Src, FOpaqueStorage &Dest) {
+            static constexpr void CopyAssign(const FOpaqueStorage &Src, FOpaqueStorage &Dest, const Allocator &Alloc) {
                 if constexpr (FitsSmallStorage<U>) {
                     *std::bit_cast<U *>(Dest.SmallStorage.data()) =
                         *std::bit_cast<const U *>(Src.SmallStorage.data());
+                } else if constexpr (UsesSharedStorage<U>) {
+                    if (Src.LargeStorage != Dest.LargeStorage) {
+                        Destroy(Dest, Alloc);
+                        Copy(Src, Dest, Alloc);
+                    }
                 } else {
                     *static_cast<U *>(Dest.LargeStorage) = *static_cast<const U *>(Src.LargeStorage);
                 }
             }
 
-            static constexpr void Move(FOpaqueStorage &Src, FOpaqueStorage &Dest) {
+            static constexpr void Move(FOpaqueStorage &Src, FOpaqueStorage &Dest, const Allocator &Alloc) {
                 if constexpr (FitsSmallStorage<U>) {
-                    Dest.template Emplace<U>(std::move(*std::bit_cast<U *>(Src.SmallStorage.data())));
+                    Dest.template Emplace<U>(Alloc, std::move(*std::bit_cast<U *>(Src.SmallStorage.data())));
+                } else if constexpr (UsesSharedStorage<U>) {
+                    // Moving out of a shared value would modify the other copies, so we share the value instead
+                    Copy(Src, Dest, Alloc);
                 } else {
-                    Dest.template Emplace<U>(std::move(*static_cast<U *>(Src.LargeStorage)));
+                    Dest.template Emplace<U>(Alloc, std::move(*static_cast<U *>(Src.LargeStorage)));
                 }
             }
 
-            static constexpr void MoveAssign(FOpaqueStorage &Src, FOpaqueStorage &Dest) {
+            static constexpr void MoveAssign(FOpaqueStorage &Src, FOpaqueStorage &Dest, const Allocator &Alloc) {
                 if constexpr (FitsSmallStorage<U>) {
                     *std::bit_cast<U *>(Dest.SmallStorage.data()) =
                         std::move(*std::bit_cast<U *>(Src.SmallStorage.data()));
+                } else if constexpr (UsesSharedStorage<U>) {
+                    CopyAssign(Src, Dest, Alloc);
                 } else {
                     *static_cast<U *>(Dest.LargeStorage) = std::move(*static_cast<U *>(Src.LargeStorage));
                 }
@@ -491,7 +719,10 @@ namespace Retro {
             requires std::derived_from<U, T>
         static const FVTable *GetVtable() {
             using ImplType = TVTableImpl<U>;
-            static constexpr FVTable Vtable = {.GetType = &ImplType::GetType,
+            static constexpr FVTable Vtable = {.IsLarge = !FitsSmallStorage<U>,
+                                              .IsTriviallyRelocatable =
+                                                  FitsSmallStorage<U> && IsTriviallyRelocatable<U>,
+                                              .GetType = &ImplType::GetType,
                                               .GetSize = &ImplType::GetSize,
                                               .GetValue = &ImplType::GetValue,
                                               .GetConstValue = &ImplType::GetConstValue,
@@ -505,6 +736,29 @@ namespace Retro {
 
         FOpaqueStorage Storage;
         const FVTable *Vtable = GetVtable<T>();
+        RETROLIB_NO_UNIQUE_ADDRESS Allocator Alloc;
     };
 
+    /**
+     * A polymorphic value that allocates any derived types that do not fit in the small storage from a
+     * `std::pmr::memory_resource`, such as a `std::pmr::monotonic_buffer_resource` used as a per-frame arena.
+     *
+     * @tparam T The base class type which all stored objects must derive from.
+     * @tparam SmallStorageSize The size of the inline buffer used to store derived types without allocating.
+     */
+    RETROLIB_EXPORT template <Class T, size_t SmallStorageSize = DEFAULT_SMALL_STORAGE_SIZE>
+    using TPmrPolymorphic = TPolymorphic<T, SmallStorageSize, std::pmr::polymorphic_allocator<std::byte>>;
+
+    /**
+     * A polymorphic value whose large derived types are shared between copies until one of them is accessed mutably.
+     * This makes copying read-mostly values, such as snapshots of configuration objects, O(1).
+     *
+     * @tparam T The base class type which all stored objects must derive from.
+     * @tparam SmallStorageSize The size of the inline buffer used to store derived types without allocating.
+     * @tparam Allocator The allocator used to obtain memory for derived types that do not fit in the inline buffer.
+     */
+    RETROLIB_EXPORT template <Class T, size_t SmallStorageSize = DEFAULT_SMALL_STORAGE_SIZE,
+                              typename Allocator = std::allocator<std::byte>>
+    using TCowPolymorphic = TPolymorphic<T, SmallStorageSize, Allocator, EPolymorphicCopyPolicy::CopyOnWrite>;
+
 } // namespace retro
@@ -0,0 +1,573 @@
+/**
+ * @file PolymorphicVector.h
+ * @brief Contains the declaration for a container of polymorphic values grouped by their dynamic type.
+ *
+ * @author Retro & Chill
+ * https://github.com/retroandchill
+ */
+#pragma once
+
+#include "RetroLib/Concepts/Inheritance.h"
+#include "RetroLib/RetroLibMacros.h"
+#include "RetroLib/TypeTraits.h"
+
+#if !RETROLIB_WITH_MODULES
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <span>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+#endif
+
+#ifndef RETROLIB_EXPORT
+#define RETROLIB_EXPORT
+#endif
+
+namespace Retro {
+    /**
+     * @brief A container of objects derived from a common base class, where each dynamic type is stored in its own
+     * contiguous array.
+     *
+     * Unlike a `std::vector<TPolymorphic<T>>`, the elements do not carry their own vtable pointer or padded inline
+     * buffer, so objects of the same type are packed next to each other in memory. Iteration visits each type's array
+     * in turn, and ForEach can be given a list of known derived types so that the calls for those types can be
+     * devirtualized and inlined in bulk.
+     *
+     * @note Elements are grouped by type, so the iteration order is only the insertion order within each type.
+     *
+     * @tparam T The base class type which all stored objects must derive from.
+     * @tparam Allocator The allocator used to obtain the storage for the per-type arrays.
+     */
+    RETROLIB_EXPORT template <Class T, typename Allocator = std::allocator<std::byte>>
+    class TPolymorphicVector {
+        struct FSegment;
+
+        template <bool Const>
+        class TIterator {
+          public:
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+
+            TIterator() = default;
+
+            /**
+             * Converts a mutable iterator into a const iterator.
+             *
+             * @param Other The iterator to convert
+             */
+            template <bool OtherConst>
+                requires Const && (!OtherConst)
+            explicit(false) TIterator(const TIterator<OtherConst> &Other)
+                : Segment(Other.Segment), Last(Other.Last), Index(Other.Index) {
+            }
+
+            TMaybeConst<Const, T> &operator*() const {
+                return *std::bit_cast<TMaybeConst<Const, T> *>(Segment->Data + Index * Segment->Stride +
+                                                               Segment->BaseOffset);
+            }
+
+            TIterator &operator++() {
+                if (++Index == Segment->Size) {
+                    ++Segment;
+                    Index = 0;
+                    SkipEmptySegments();
+                }
+
+                return *this;
+            }
+
+            TIterator operator++(int) {
+                auto Copy = *this;
+                ++*this;
+                return Copy;
+            }
+
+            bool operator==(const TIterator &) const = default;
+
+          private:
+            friend class TPolymorphicVector;
+
+            template <bool>
+            friend class TIterator;
+
+            TIterator(const FSegment *Segment, const FSegment *Last) : Segment(Segment), Last(Last) {
+                SkipEmptySegments();
+            }
+
+            void SkipEmptySegments() {
+                while (Segment != Last && Segment->Size == 0) {
+                    ++Segment;
+                }
+            }
+
+            const FSegment *Segment = nullptr;
+            const FSegment *Last = nullptr;
+            size_t Index = 0;
+        };
+
+      public:
+        using Iterator = TIterator<false>;
+        using ConstIterator = TIterator<true>;
+
+        /**
+         * Constructs an empty vector.
+         */
+        TPolymorphicVector() = default;
+
+        /**
+         * Constructs an empty vector that obtains its storage from the given allocator.
+         *
+         * @param Alloc The allocator to use
+         */
+        explicit TPolymorphicVector(const Allocator &Alloc) : Alloc(Alloc) {
+        }
+
+        /**
+         * Copies every element of another vector. The allocator is obtained the same way a standard container would.
+         *
+         * @param Other The vector to copy
+         */
+        TPolymorphicVector(const TPolymorphicVector &Other)
+            : Alloc(FAllocatorTraits::select_on_container_copy_construction(Other.Alloc)) {
+            CopySegmentsFrom(Other);
+        }
+
+        /**
+         * Takes ownership of the storage of another vector, which is left empty.
+         *
+         * @param Other The vector to move from
+         */
+        TPolymorphicVector(TPolymorphicVector &&Other) noexcept
+            : Segments(std::exchange(Other.Segments, {})), Count(std::exchange(Other.Count, 0)), Alloc(Other.Alloc) {
+        }
+
+        ~TPolymorphicVector() {
+            Release();
+        }
+
+        /**
+         * Replaces the contents of this vector with a copy of every element of another vector.
+         *
+         * @param Other The vector to copy
+         * @return A reference to this vector
+         */
+        TPolymorphicVector &operator=(const TPolymorphicVector &Other) {
+            if (this != &Other) {
+                Release();
+                if constexpr (FAllocatorTraits::propagate_on_container_copy_assignment::value) {
+                    Alloc = Other.Alloc;
+                }
+                CopySegmentsFrom(Other);
+            }
+
+            return *this;
+        }
+
+        /**
+         * Replaces the contents of this vector with the contents of another vector, which is left empty. The storage is
+         * taken over when the allocators allow it, otherwise each element is moved individually, which allocates.
+         *
+         * @param Other The vector to move from
+         * @return A reference to this vector
+         */
+        TPolymorphicVector &operator=(TPolymorphicVector &&Other) noexcept(
+            FAllocatorTraits::propagate_on_container_move_assignment::value ||
+            FAllocatorTraits::is_always_equal::value) {
+            if (this == &Other) {
+                return *this;
+            }
+
+            Release();
+            if constexpr (FAllocatorTraits::propagate_on_container_move_assignment::value) {
+                Alloc = Other.Alloc;
+            }
+
+            if (Alloc == Other.Alloc) {
+                Segments = std::exchange(Other.Segments, {});
+                Count = std::exchange(Other.Count, 0);
+            } else {
+                MoveSegmentsFrom(Other);
+                Other.Release();
+            }
+
+            return *this;
+        }
+
+        /**
+         * Constructs a new element of the given type at the end of that type's array.
+         *
+         * @tparam U The type of element to construct
+         * @tparam A The types of the constructor arguments
+         * @param Args The arguments to construct the new element with
+         * @return A reference to the new element
+         */
+        template <typename U, typename... A>
+            requires std::derived_from<U, T> && std::constructible_from<U, A...>
+        U &Emplace(A &&...Args) {
+            using FImpl = TSegmentImpl<U>;
+            auto &Segment = FindOrAddSegment<U>();
+            if (Segment.Size == Segment.Capacity) {
+                FImpl::Reserve(Segment, Alloc, std::max(Segment.Capacity * 2, MIN_SEGMENT_CAPACITY));
+            }
+
+            U *Element = FImpl::GetData(Segment) + Segment.Size;
+            typename TAllocatorTraits<U>::allocator_type Rebound(Alloc);
+            TAllocatorTraits<U>::construct(Rebound, Element, std::forward<A>(Args)...);
+            Segment.BaseOffset =
+                std::bit_cast<std::byte *>(static_cast<T *>(Element)) - std::bit_cast<std::byte *>(Element);
+            Segment.Size++;
+            Count++;
+            return *Element;
+        }
+
+        /**
+         * Adds a copy of the given value to the end of its type's array.
+         *
+         * @tparam U The type of value to add
+         * @param Value The value to add
+         * @return A reference to the new element
+         */
+        template <typename U>
+            requires std::derived_from<std::decay_t<U>, T>
+        std::decay_t<U> &Add(U &&Value) {
+            return Emplace<std::decay_t<U>>(std::forward<U>(Value));
+        }
+
+        /**
+         * Reserves space in the array for the given type, so that it can hold at least the given number of elements
+         * without reallocating.
+         *
+         * @tparam U The type of element to reserve space for
+         * @param Capacity The number of elements to reserve space for
+         */
+        template <typename U>
+            requires std::derived_from<U, T>
+        void Reserve(size_t Capacity) {
+            auto &Segment = FindOrAddSegment<U>();
+            if (Capacity > Segment.Capacity) {
+                TSegmentImpl<U>::Reserve(Segment, Alloc, Capacity);
+            }
+        }
+
+        /**
+         * Gets all elements of exactly the given type as a contiguous span. Calls made through the span know the
+         * dynamic type of the elements, so they do not need to go through the vtable.
+         *
+         * @tparam U The type of element to get
+         * @return The elements of the given type, which is empty if there are none
+         */
+        template <typename U>
+            requires std::derived_from<U, T>
+        std::span<U> GetSegment() {
+            auto Segment = FindSegment<U>();
+            return Segment != nullptr ? TSegmentImpl<U>::GetElements(*Segment) : std::span<U>();
+        }
+
+        /**
+         * Gets all elements of exactly the given type as a contiguous span. Calls made through the span know the
+         * dynamic type of the elements, so they do not need to go through the vtable.
+         *
+         * @tparam U The type of element to get
+         * @return The elements of the given type, which is empty if there are none
+         */
+        template <typename U>
+            requires std::derived_from<U, T>
+        std::span<const U> GetSegment() const {
+            auto Segment = FindSegment<U>();
+            return Segment != nullptr ? TSegmentImpl<U>::GetElements(*Segment) : std::span<const U>();
+        }
+
+        /**
+         * Invokes the functor on every element in the vector, one type's array at a time. Elements of one of the listed
+         * types are passed as that type, which allows the compiler to devirtualize and inline the calls made on them,
+         * while any other elements are passed as a reference to the base class.
+         *
+         * @tparam U The derived types to visit with their concrete type
+         * @tparam F The type of functor to invoke
+         * @param Functor The functor to invoke
+         */
+        template <typename... U, typename F>
+            requires(std::derived_from<U, T> && ...)
+        void ForEach(F &&Functor) {
+            ForEachImpl<U...>(*this, Functor);
+        }
+
+        /**
+         * Invokes the functor on every element in the vector, one type's array at a time. Elements of one of the listed
+         * types are passed as that type, which allows the compiler to devirtualize and inline the calls made on them,
+         * while any other elements are passed as a reference to the base class.
+         *
+         * @tparam U The derived types to visit with their concrete type
+         * @tparam F The type of functor to invoke
+         * @param Functor The functor to invoke
+         */
+        template <typename... U, typename F>
+            requires(std::derived_from<U, T> && ...)
+        void ForEach(F &&Functor) const {
+            ForEachImpl<U...>(*this, Functor);
+        }
+
+        /**
+         * Destroys every element in the vector, while keeping the storage of each type's array for reuse.
+         */
+        void Clear() noexcept {
+            for (auto &Segment : Segments) {
+                Segment.Vtable->Clear(Segment, Alloc);
+            }
+            Count = 0;
+        }
+
+        Iterator begin() {
+            return Iterator(Segments.data(), Segments.data() + Segments.size());
+        }
+
+        ConstIterator begin() const {
+            return ConstIterator(Segments.data(), Segments.data() + Segments.size());
+        }
+
+        Iterator end() {
+            auto Last = Segments.data() + Segments.size();
+            return Iterator(Last, Last);
+        }
+
+        ConstIterator end() const {
+            auto Last = Segments.data() + Segments.size();
+            return ConstIterator(Last, Last);
+        }
+
+        size_t size() const noexcept {
+            return Count;
+        }
+
+        bool empty() const noexcept {
+            return Count == 0;
+        }
+
+        /**
+         * Gets the allocator used by this vector.
+         *
+         * @return The allocator
+         */
+        const Allocator &GetAllocator() const noexcept {
+            return Alloc;
+        }
+
+      private:
+        static constexpr size_t MIN_SEGMENT_CAPACITY = 4;
+
+        using FAllocatorTraits = std::allocator_traits<Allocator>;
+
+        template <typename U>
+        using TAllocatorTraits = typename FAllocatorTraits::template rebind_traits<U>;
+
+        struct FSegmentVTable {
+            const std::type_info &(*GetType)();
+            void (*Clear)(FSegment &Segment, const Allocator &Alloc);
+            void (*Release)(FSegment &Segment, const Allocator &Alloc);
+            void (*Copy)(const FSegment &Src, FSegment &Dest, const Allocator &Alloc);
+            void (*Move)(FSegment &Src, FSegment &Dest, const Allocator &Alloc);
+        };
+
+        /**
+         * The contiguous array of every element of a single dynamic type. The stride and base offset are stored
+         * alongside the array so that elements can be accessed as the base class without an indirect call.
+         */
+        struct FSegment {
+            const FSegmentVTable *Vtable;
+            size_t Stride;
+            std::byte *Data = nullptr;
+            size_t Size = 0;
+            size_t Capacity = 0;
+            std::ptrdiff_t BaseOffset = 0;
+        };
+
+        template <typename U>
+        struct TSegmentImpl {
+            static const std::type_info &GetType() {
+                return typeid(U);
+            }
+
+            static U *GetData(const FSegment &Segment) {
+                return std::bit_cast<U *>(Segment.Data);
+            }
+
+            static std::span<U> GetElements(const FSegment &Segment) {
+                return std::span<U>(GetData(Segment), Segment.Size);
+            }
+
+            static void Reserve(FSegment &Segment, const Allocator &Alloc, size_t Capacity) {
+                typename TAllocatorTraits<U>::allocator_type Rebound(Alloc);
+                U *NewData = TAllocatorTraits<U>::allocate(Rebound, Capacity);
+                U *OldData = GetData(Segment);
+                if constexpr (IsTriviallyRelocatable<U>) {
+                    if (Segment.Size > 0) {
+                        std::memcpy(static_cast<void *>(NewData), static_cast<const void *>(OldData),
+                                    Segment.Size * sizeof(U));
+                    }
+                } else {
+                    for (size_t i = 0; i < Segment.Size; i++) {
+                        TAllocatorTraits<U>::construct(Rebound, NewData + i, std::move(OldData[i]));
+                        TAllocatorTraits<U>::destroy(Rebound, OldData + i);
+                    }
+                }
+
+                if (OldData != nullptr) {
+                    TAllocatorTraits<U>::deallocate(Rebound, OldData, Segment.Capacity);
+                }
+                Segment.Data = std::bit_cast<std::byte *>(NewData);
+                Segment.Capacity = Capacity;
+            }
+
+            static void Clear(FSegment &Segment, const Allocator &Alloc) {
+                typename TAllocatorTraits<U>::allocator_type Rebound(Alloc);
+                U *Data = GetData(Segment);
+                for (size_t i = 0; i < Segment.Size; i++) {
+                    TAllocatorTraits<U>::destroy(Rebound, Data + i);
+                }
+                Segment.Size = 0;
+            }
+
+            static void Release(FSegment &Segment, const Allocator &Alloc) {
+                Clear(Segment, Alloc);
+                if (Segment.Data != nullptr) {
+                    typename TAllocatorTraits<U>::allocator_type Rebound(Alloc);
+                    TAllocatorTraits<U>::deallocate(Rebound, GetData(Segment), Segment.Capacity);
+                    Segment.Data = nullptr;
+                    Segment.Capacity = 0;
+                }
+            }
+
+            static void Copy(const FSegment &Src, FSegment &Dest, const Allocator &Alloc) {
+                Reserve(Dest, Alloc, Src.Size);
+                typename TAllocatorTraits<U>::allocator_type Rebound(Alloc);
+                for (const U &Element : GetElements(Src)) {
+                    TAllocatorTraits<U>::construct(Rebound, GetData(Dest) + Dest.Size, Element);
+                    Dest.Size++;
+                }
+                Dest.BaseOffset = Src.BaseOffset;
+            }
+
+            static void Move(FSegment &Src, FSegment &Dest, const Allocator &Alloc) {
+                Reserve(Dest, Alloc, Src.Size);
+                typename TAllocatorTraits<U>::allocator_type Rebound(Alloc);
+                for (U &Element : GetElements(Src)) {
+                    TAllocatorTraits<U>::construct(Rebound, GetData(Dest) + Dest.Size, std::move(Element));
+                    Dest.Size++;
+                }
+                Dest.BaseOffset = Src.BaseOffset;
+            }
+        };
+
+        template <typename U>
+            requires std::derived_from<U, T>
+        static const FSegmentVTable *GetVtable() {
+            using ImplType = TSegmentImpl<U>;
+            static constexpr FSegmentVTable Vtable = {.GetType = &ImplType::GetType,
+                                                      .Clear = &ImplType::Clear,
+                                                      .Release = &ImplType::Release,
+                                                      .Copy = &ImplType::Copy,
+                                                      .Move = &ImplType::Move};
+            return &Vtable;
+        }
+
+        template <typename U>
+        static bool IsSegmentOf(const FSegment &Segment) {
+            // The vtable is usually unique, but may be duplicated when the vector is used across shared libraries
+            return Segment.Vtable == GetVtable<U>() || Segment.Vtable->GetType() == typeid(U);
+        }
+
+        template <typename U>
+        const FSegment *FindSegment() const {
+            auto Match =
+                std::ranges::find_if(Segments, [](const FSegment &Segment) { return IsSegmentOf<U>(Segment); });
+            return Match != Segments.end() ? &*Match : nullptr;
+        }
+
+        template <typename U>
+        FSegment &FindOrAddSegment() {
+            if (auto Segment = FindSegment<U>(); Segment != nullptr) {
+                return const_cast<FSegment &>(*Segment);
+            }
+
+            return Segments.emplace_back(FSegment{.Vtable = GetVtable<U>(), .Stride = sizeof(U)});
+        }
+
+        template <typename... U, typename S, typename F>
+        static void ForEachImpl(S &Self, F &Functor) {
+            using FBase = TMaybeConst<std::is_const_v<S>, T>;
+            for (const FSegment &Segment : Self.Segments) {
+                if (Segment.Size == 0) {
+                    continue;
+                }
+
+                bool Visited = (ForEachInSegment<TMaybeConst<std::is_const_v<S>, U>>(Segment, Functor) || ...);
+                if (Visited) {
+                    continue;
+                }
+
+                auto Base = Segment.Data + Segment.BaseOffset;
+                for (size_t i = 0; i < Segment.Size; i++) {
+                    std::invoke(Functor, *std::bit_cast<FBase *>(Base + i * Segment.Stride));
+                }
+            }
+        }
+
+        template <typename U, typename F>
+        static bool ForEachInSegment(const FSegment &Segment, F &Functor) {
+            if (!IsSegmentOf<std::remove_const_t<U>>(Segment)) {
+                return false;
+            }
+
+            for (U &Element : TSegmentImpl<std::remove_const_t<U>>::GetElements(Segment)) {
+                std::invoke(Functor, Element);
+            }
+            return true;
+        }
+
+        void CopySegmentsFrom(const TPolymorphicVector &Other) {
+            Segments.reserve(Other.Segments.size());
+            for (const FSegment &Segment : Other.Segments) {
+                auto &Copy = Segments.emplace_back(FSegment{.Vtable = Segment.Vtable, .Stride = Segment.Stride});
+                Segment.Vtable->Copy(Segment, Copy, Alloc);
+            }
+            Count = Other.Count;
+        }
+
+        void MoveSegmentsFrom(TPolymorphicVector &Other) {
+            Segments.reserve(Other.Segments.size());
+            for (FSegment &Segment : Other.Segments) {
+                auto &Moved = Segments.emplace_back(FSegment{.Vtable = Segment.Vtable, .Stride = Segment.Stride});
+                Segment.Vtable->Move(Segment, Moved, Alloc);
+            }
+            Count = Other.Count;
+        }
+
+        void Release() noexcept {
+            for (auto &Segment : Segments) {
+                Segment.Vtable->Release(Segment, Alloc);
+            }
+            Segments.clear();
+            Count = 0;
+        }
+
+        std::vector<FSegment> Segments;
+        size_t Count = 0;
+        RETROLIB_NO_UNIQUE_ADDRESS Allocator Alloc;
+    };
+
+    /**
+     * A polymorphic vector that obtains the storage for each type's array from a `std::pmr::memory_resource`.
+     *
+     * @tparam T The base class type which all stored objects must derive from.
+     */
+    RETROLIB_EXPORT template <Class T>
+    using TPmrPolymorphicVector = TPolymorphicVector<T, std::pmr::polymorphic_allocator<std::byte>>;
+
+} // namespace retro
@@ -0,0 +1,176 @@
+/**
+ * @file StaticVector.h
+ * @brief Contains the declaration for a vector with a fixed capacity that stores its elements inline.
+ *
+ * @author Retro & Chill
+ * https://github.com/retroandchill
+ */
+#pragma once
+
+#if !RETROLIB_WITH_MODULES
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+#endif
+
+#ifndef RETROLIB_EXPORT
+#define RETROLIB_EXPORT
+#endif
+
+namespace Retro {
+    /**
+     * @brief A vector with a capacity fixed at compile time, which stores its elements inline and never allocates.
+     *
+     * Every operation is usable in constant expressions, which makes it suitable for holding the result of a range
+     * pipeline that is evaluated at compile time when the exact number of elements is not known ahead of time. The
+     * interface mirrors the standard sequence containers so that it works with the generic container algorithms.
+     * Exceeding the capacity throws a `std::length_error`, which is reported as a compile error during constant
+     * evaluation.
+     *
+     * @note The storage is a `std::array`, so the element type must be default constructible and slots past the end
+     * of the vector hold default constructed values.
+     *
+     * @tparam T The type of the elements
+     * @tparam N The maximum number of elements
+     */
+    RETROLIB_EXPORT template <std::default_initializable T, size_t N>
+    class TStaticVector {
+      public:
+        using value_type = T;
+        using size_type = size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = T &;
+        using const_reference = const T &;
+        using iterator = T *;
+        using const_iterator = const T *;
+
+        constexpr TStaticVector() = default;
+
+        /**
+         * Constructs a new element at the end of the vector.
+         *
+         * @param Args The arguments used to construct the element
+         * @return A reference to the new element
+         * @throws std::length_error If the vector is already full
+         */
+        template <typename... A>
+            requires std::constructible_from<T, A...>
+        constexpr T &emplace_back(A &&...Args) {
+            if (Size == N) {
+                throw std::length_error("TStaticVector capacity exceeded");
+            }
+
+            Data[Size] = T(std::forward<A>(Args)...);
+            return Data[Size++];
+        }
+
+        /**
+         * Adds an element to the end of the vector.
+         *
+         * @param Value The element to add
+         * @throws std::length_error If the vector is already full
+         */
+        constexpr void push_back(const T &Value) {
+            emplace_back(Value);
+        }
+
+        /**
+         * Adds an element to the end of the vector.
+         *
+         * @param Value The element to add
+         * @throws std::length_error If the vector is already full
+         */
+        constexpr void push_back(T &&Value) {
+            emplace_back(std::move(Value));
+        }
+
+        /**
+         * Removes the last element of the vector.
+         */
+        constexpr void pop_back() {
+            Data[--Size] = T();
+        }
+
+        /**
+         * Checks that the vector can hold the given number of elements. The storage is always the full capacity, so
+         * this never allocates, but it allows a sized range that is too large to be diagnosed before any of its
+         * elements are added.
+         *
+         * @param Count The number of elements to hold
+         * @throws std::length_error If the count is greater than the capacity
+         */
+        constexpr void reserve(size_t Count) const {
+            if (Count > N) {
+                throw std::length_error("TStaticVector capacity exceeded");
+            }
+        }
+
+        /**
+         * Removes every element from the vector.
+         */
+        constexpr void clear() {
+            while (Size > 0) {
+                pop_back();
+            }
+        }
+
+        constexpr T &operator[](size_t Index) {
+            return Data[Index];
+        }
+
+        constexpr const T &operator[](size_t Index) const {
+            return Data[Index];
+        }
+
+        constexpr T *data() noexcept {
+            return Data.data();
+        }
+
+        constexpr const T *data() const noexcept {
+            return Data.data();
+        }
+
+        constexpr T *begin() noexcept {
+            return Data.data();
+        }
+
+        constexpr const T *begin() const noexcept {
+            return Data.data();
+        }
+
+        constexpr T *end() noexcept {
+            return Data.data() + Size;
+        }
+
+        constexpr const T *end() const noexcept {
+            return Data.data() + Size;
+        }
+
+        constexpr size_t size() const noexcept {
+            return Size;
+        }
+
+        constexpr bool empty() const noexcept {
+            return Size == 0;
+        }
+
+        static constexpr size_t capacity() noexcept {
+            return N;
+        }
+
+        static constexpr size_t max_size() noexcept {
+            return N;
+        }
+
+        constexpr bool operator==(const TStaticVector &Other) const {
+            return Size == Other.Size && std::equal(begin(), end(), Other.begin());
+        }
+
+      private:
+        std::array<T, N> Data{};
+        size_t Size = 0;
+    };
+} // namespace Retro
@@ -0,0 +1,499 @@
+/**
+ * @file TaggedUnion.h
+ * @brief Compact storage for one of several alternatives that is dispatched on with a switch over its index.
+ *
+ * @author Retro & Chill
+ * https://github.com/retroandchill
+ */
+#pragma once
+
+#include "RetroLib/RetroLibMacros.h"
+#include "RetroLib/Utils/ForwardLike.h"
+#include "RetroLib/Utils/Unreachable.h"
+#include "RetroLib/Utils/Variant.h"
+
+#if !RETROLIB_WITH_MODULES
+#include <concepts>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#endif
+
+#ifndef RETROLIB_EXPORT
+#define RETROLIB_EXPORT
+#endif
+
+namespace Retro {
+    RETROLIB_EXPORT template <typename... T>
+        requires(sizeof...(T) > 0)
+    class TTaggedUnion;
+
+    namespace Detail {
+        /**
+         * Placeholder alternative that is active while the storage of a tagged union is being filled in.
+         */
+        struct FEmptyAlternative {};
+
+        /**
+         * Recursive union that holds one of the alternatives of a tagged union. Special members are only trivial if
+         * they are trivial for every alternative, in which case the whole tagged union stays trivially copyable.
+         */
+        template <typename... T>
+        union TTaggedUnionStorage;
+
+        template <>
+        union TTaggedUnionStorage<> {};
+
+        template <typename T, typename... R>
+        union TTaggedUnionStorage<T, R...> {
+            FEmptyAlternative Empty;
+            T Head;
+            TTaggedUnionStorage<R...> Tail;
+
+            constexpr TTaggedUnionStorage() : Empty() {
+            }
+
+            template <typename... A>
+            constexpr explicit TTaggedUnionStorage(std::in_place_index_t<0>, A &&...Args)
+                : Head(std::forward<A>(Args)...) {
+            }
+
+            template <size_t I, typename... A>
+                requires(I > 0)
+            constexpr explicit TTaggedUnionStorage(std::in_place_index_t<I>, A &&...Args)
+                : Tail(std::in_place_index<I - 1>, std::forward<A>(Args)...) {
+            }
+
+            constexpr ~TTaggedUnionStorage()
+                requires std::is_trivially_destructible_v<T> && (std::is_trivially_destructible_v<R> && ...)
+            = default;
+
+            constexpr ~TTaggedUnionStorage() {
+                // The tagged union destroys the active alternative, as only it knows which one that is
+            }
+        };
+
+        /**
+         * Storage used when every alternative of a tagged union has the same type, where a single value is enough and
+         * the index only records which alternative it stands in for.
+         */
+        template <typename T>
+        struct TSharedAlternativeStorage {
+            T Value;
+
+            template <size_t I, typename... A>
+            constexpr explicit TSharedAlternativeStorage(std::in_place_index_t<I>, A &&...Args)
+                : Value(std::forward<A>(Args)...) {
+            }
+        };
+
+        template <size_t I, typename S>
+        constexpr auto &GetAlternative(S &Storage) noexcept {
+            if constexpr (I == 0) {
+                return Storage.Head;
+            } else {
+                return GetAlternative<I - 1>(Storage.Tail);
+            }
+        }
+
+        template <typename U>
+        struct TIsTaggedUnion : std::false_type {};
+
+        template <typename... T>
+        struct TIsTaggedUnion<TTaggedUnion<T...>> : std::true_type {};
+    } // namespace Detail
+
+    /**
+     * Concept for any specialization of TTaggedUnion, ignoring references and cv-qualifiers.
+     *
+     * @tparam U The type to check
+     */
+    RETROLIB_EXPORT template <typename U>
+    concept TaggedUnionType = Detail::TIsTaggedUnion<std::remove_cvref_t<U>>::value;
+
+    /**
+     * @brief Holds exactly one of several alternatives, identified by an index that is as small as possible.
+     *
+     * This fills the same role as `std::variant`, but is meant for the hot loops of the range adapters that need to
+     * switch between several iterator types. The index is a single byte for up to 255 alternatives, the type is
+     * trivially copyable when every alternative is, and visiting it with VisitIndex compiles down to a switch over the
+     * index that the optimizer can see through, instead of an indirect call through a table of function pointers.
+     *
+     * When every alternative has the same type only a single value is stored, along with the index of the alternative
+     * that it currently stands in for. GetShared can then access the value without looking at the index at all.
+     *
+     * @note Unlike `std::variant`, alternatives are always accessed by index, and there is no valueless state. To
+     *       keep it that way, a union can only be assigned to when every alternative is nothrow move constructible,
+     *       and Emplace builds the new alternative before destroying the old one unless doing so cannot throw.
+     *
+     * @tparam T The types of the alternatives
+     */
+    RETROLIB_EXPORT template <typename... T>
+        requires(sizeof...(T) > 0)
+    class TTaggedUnion {
+        template <typename... U>
+            requires(sizeof...(U) > 0)
+        friend class TTaggedUnion;
+
+      public:
+        /**
+         * The type of the alternative with the given index.
+         */
+        template <size_t I>
+        using TAlternative = std::tuple_element_t<I, std::tuple<T...>>;
+
+        /**
+         * The number of alternatives.
+         */
+        static constexpr size_t AlternativeCount = sizeof...(T);
+
+        /**
+         * Whether every alternative has the same type, in which case they all share a single value.
+         */
+        static constexpr bool bSharedAlternative = (std::same_as<TAlternative<0>, T> && ...);
+
+        using IndexType = std::conditional_t<(sizeof...(T) <= std::numeric_limits<uint8_t>::max()), uint8_t, size_t>;
+
+      private:
+        using StorageType = std::conditional_t<bSharedAlternative, Detail::TSharedAlternativeStorage<TAlternative<0>>,
+                                               Detail::TTaggedUnionStorage<T...>>;
+
+        static constexpr bool bDefaultCopyAssign =
+            std::is_copy_assignable_v<StorageType> &&
+            (bSharedAlternative || std::is_trivially_destructible_v<StorageType>);
+        static constexpr bool bDefaultMoveAssign =
+            std::is_move_assignable_v<StorageType> &&
+            (bSharedAlternative || std::is_trivially_destructible_v<StorageType>);
+
+      public:
+        /**
+         * Default constructs the first alternative.
+         */
+        constexpr TTaggedUnion()
+            requires std::default_initializable<TAlternative<0>>
+            : Storage(std::in_place_index<0>) {
+        }
+
+        /**
+         * Constructs the alternative with the given index in place.
+         *
+         * @tparam I The index of the alternative
+         * @param Args The arguments to construct the alternative from
+         */
+        template <size_t I, typename... A>
+            requires(I < sizeof...(T)) && std::constructible_from<TAlternative<I>, A...>
+        constexpr explicit TTaggedUnion(std::in_place_index_t<I>, A &&...Args)
+            : Storage(std::in_place_index<I>, std::forward<A>(Args)...), Index(static_cast<IndexType>(I)) {
+        }
+
+        /**
+         * Converts from a tagged union whose alternatives can each be converted into the matching alternative of this
+         * one, keeping the same index.
+         *
+         * @param Other The tagged union to convert
+         */
+        template <typename... U>
+            requires(sizeof...(U) == sizeof...(T)) && (!std::same_as<TTaggedUnion<U...>, TTaggedUnion>) &&
+                    (std::constructible_from<T, U> && ...)
+        constexpr explicit TTaggedUnion(TTaggedUnion<U...> Other)
+            : TTaggedUnion(VisitIndex<TTaggedUnion>(
+                  []<typename E, size_t I>(TIndexedElement<E, I> Element) {
+                      return TTaggedUnion(std::in_place_index<I>, std::move(Element.Get()));
+                  },
+                  Other)) {
+        }
+
+        constexpr TTaggedUnion(const TTaggedUnion &)
+            requires std::is_copy_constructible_v<StorageType>
+        = default;
+
+        constexpr TTaggedUnion(const TTaggedUnion &Other)
+            requires(!std::is_copy_constructible_v<StorageType>) && (std::copy_constructible<T> && ...)
+        {
+            ConstructFrom(Other);
+        }
+
+        constexpr TTaggedUnion(TTaggedUnion &&)
+            requires std::is_move_constructible_v<StorageType>
+        = default;
+
+        constexpr TTaggedUnion(TTaggedUnion &&Other) noexcept((std::is_nothrow_move_constructible_v<T> && ...))
+            requires(!std::is_move_constructible_v<StorageType>) && (std::move_constructible<T> && ...)
+        {
+            ConstructFrom(std::move(Other));
+        }
+
+        constexpr ~TTaggedUnion()
+            requires bSharedAlternative || std::is_trivially_destructible_v<StorageType>
+        = default;
+
+        constexpr ~TTaggedUnion() {
+            Reset();
+        }
+
+        constexpr TTaggedUnion &operator=(const TTaggedUnion &)
+            requires bDefaultCopyAssign
+        = default;
+
+        constexpr TTaggedUnion &operator=(const TTaggedUnion &Other)
+            requires(!bDefaultCopyAssign) && (std::copy_constructible<T> && ...) &&
+                    (std::is_nothrow_move_constructible_v<T> && ...)
+        {
+            if (this != &Other) {
+                // Copy first, so that an exception while copying leaves this union untouched
+                *this = TTaggedUnion(Other);
+            }
+
+            return *this;
+        }
+
+        constexpr TTaggedUnion &operator=(TTaggedUnion &&)
+            requires bDefaultMoveAssign
+        = default;
+
+        constexpr TTaggedUnion &operator=(TTaggedUnion &&Other) noexcept
+            requires(!bDefaultMoveAssign) && (std::is_nothrow_move_constructible_v<T> && ...)
+        {
+            if (this != &Other) {
+                Reset();
+                ConstructFrom(std::move(Other));
+            }
+
+            return *this;
+        }
+
+        /**
+         * Gets the index of the active alternative.
+         *
+         * @return The index of the active alternative
+         */
+        constexpr size_t GetIndex() const noexcept {
+            return Index;
+        }
+
+        /**
+         * Gets the alternative with the given index, which must be the active one.
+         *
+         * @tparam I The index of the alternative
+         * @return A reference to the alternative
+         */
+        template <size_t I>
+            requires(I < sizeof...(T))
+        constexpr TAlternative<I> &Get() noexcept {
+            RETROLIB_ASSERT(Index == I);
+            if constexpr (bSharedAlternative) {
+                return Storage.Value;
+            } else {
+                return Detail::GetAlternative<I>(Storage);
+            }
+        }
+
+        /**
+         * Gets the alternative with the given index, which must be the active one.
+         *
+         * @tparam I The index of the alternative
+         * @return A reference to the alternative
+         */
+        template <size_t I>
+            requires(I < sizeof...(T))
+        constexpr const TAlternative<I> &Get() const noexcept {
+            RETROLIB_ASSERT(Index == I);
+            if constexpr (bSharedAlternative) {
+                return Storage.Value;
+            } else {
+                return Detail::GetAlternative<I>(Storage);
+            }
+        }
+
+        /**
+         * Gets the value shared by every alternative, whichever one is active.
+         *
+         * @return A reference to the shared value
+         */
+        constexpr TAlternative<0> &GetShared() noexcept
+            requires bSharedAlternative
+        {
+            return Storage.Value;
+        }
+
+        /**
+         * Gets the value shared by every alternative, whichever one is active.
+         *
+         * @return A reference to the shared value
+         */
+        constexpr const TAlternative<0> &GetShared() const noexcept
+            requires bSharedAlternative
+        {
+            return Storage.Value;
+        }
+
+        /**
+         * Destroys the active alternative and constructs the alternative with the given index in its place.
+         *
+         * If constructing the alternative can throw, it is first constructed on the side and then moved into place,
+         * so an exception leaves the previously active alternative untouched.
+         *
+         * @tparam I The index of the alternative
+         * @param Args The arguments to construct the alternative from
+         * @return A reference to the new alternative
+         */
+        template <size_t I, typename... A>
+            requires(I < sizeof...(T)) && std::constructible_from<TAlternative<I>, A...> &&
+                    (std::is_nothrow_constructible_v<TAlternative<I>, A...> ||
+                     std::is_nothrow_move_constructible_v<TAlternative<I>>)
+        constexpr TAlternative<I> &Emplace(A &&...Args) {
+            if constexpr (bSharedAlternative) {
+                Storage.Value = TAlternative<I>(std::forward<A>(Args)...);
+            } else if constexpr (std::is_nothrow_constructible_v<TAlternative<I>, A...>) {
+                Reset();
+                std::construct_at(std::addressof(Storage), std::in_place_index<I>, std::forward<A>(Args)...);
+            } else {
+                TAlternative<I> Value(std::forward<A>(Args)...);
+                Reset();
+                std::construct_at(std::addressof(Storage), std::in_place_index<I>, std::move(Value));
+            }
+
+            Index = static_cast<IndexType>(I);
+            return Get<I>();
+        }
+
+        /**
+         * Compares the active alternatives of two unions, which are only equal if they have the same index.
+         *
+         * @param Other The union to compare to
+         * @return Are the two unions equal
+         */
+        constexpr bool operator==(const TTaggedUnion &Other) const
+            requires(std::equality_comparable<T> && ...)
+        {
+            if (Index != Other.Index) {
+                return false;
+            }
+
+            if constexpr (bSharedAlternative) {
+                return Storage.Value == Other.Storage.Value;
+            } else {
+                return VisitIndex<bool>(
+                    [&Other]<typename E, size_t I>(TIndexedElement<E, I> Element) {
+                        return Element.Get() == Other.template Get<I>();
+                    },
+                    *this);
+            }
+        }
+
+      private:
+        constexpr void Reset() noexcept {
+            if constexpr (!std::is_trivially_destructible_v<StorageType>) {
+                VisitIndex<void>([](auto Element) { std::destroy_at(std::addressof(Element.Get())); }, *this);
+            }
+        }
+
+        template <typename U>
+        constexpr void ConstructFrom(U &&Other) {
+            VisitIndex<void>(
+                [this]<typename E, size_t I>(TIndexedElement<E, I> Element) {
+                    std::construct_at(std::addressof(Storage), std::in_place_index<I>,
+                                      ForwardLike<U>(Element.Get()));
+                },
+                Other);
+            Index = Other.Index;
+        }
+
+        StorageType Storage;
+        IndexType Index = 0;
+    };
+
+    namespace Detail {
+        /**
+         * The number of alternatives that each switch statement dispatches on, with larger unions chaining into
+         * another switch for the next block of alternatives.
+         */
+        constexpr size_t TAGGED_UNION_SWITCH_CASES = 8;
+
+        template <typename R, size_t I, typename F, typename U>
+        constexpr R VisitTaggedUnionAlternative(F &&Visitor, U &Union) {
+            using UnionType = std::remove_const_t<U>;
+            if constexpr (I < UnionType::AlternativeCount) {
+                using ElementType = std::conditional_t<std::is_const_v<U>,
+                                                       const typename UnionType::template TAlternative<I>,
+                                                       typename UnionType::template TAlternative<I>>;
+                return std::invoke(std::forward<F>(Visitor),
+                                   TIndexedElement<ElementType, I>(Union.template Get<I>()));
+            } else {
+                Unreachable();
+            }
+        }
+
+        template <typename R, size_t Base, typename F, typename U>
+        constexpr R VisitTaggedUnion(F &&Visitor, U &Union) {
+            switch (Union.GetIndex() - Base) {
+            case 0:
+                return VisitTaggedUnionAlternative<R, Base>(std::forward<F>(Visitor), Union);
+            case 1:
+                return VisitTaggedUnionAlternative<R, Base + 1>(std::forward<F>(Visitor), Union);
+            case 2:
+                return VisitTaggedUnionAlternative<R, Base + 2>(std::forward<F>(Visitor), Union);
+            case 3:
+                return VisitTaggedUnionAlternative<R, Base + 3>(std::forward<F>(Visitor), Union);
+            case 4:
+                return VisitTaggedUnionAlternative<R, Base + 4>(std::forward<F>(Visitor), Union);
+            case 5:
+                return VisitTaggedUnionAlternative<R, Base + 5>(std::forward<F>(Visitor), Union);
+            case 6:
+                return VisitTaggedUnionAlternative<R, Base + 6>(std::forward<F>(Visitor), Union);
+            case 7:
+                return VisitTaggedUnionAlternative<R, Base + 7>(std::forward<F>(Visitor), Union);
+            default:
+                if constexpr (Base + TAGGED_UNION_SWITCH_CASES < std::remove_const_t<U>::AlternativeCount) {
+                    return VisitTaggedUnion<R, Base + TAGGED_UNION_SWITCH_CASES>(std::forward<F>(Visitor), Union);
+                } else {
+                    Unreachable();
+                }
+            }
+        }
+    } // namespace Detail
+
+    /**
+     * @brief Visits the active alternative of a tagged union by index.
+     *
+     * The visitor is invoked with a TIndexedElement for the active alternative, the same as when visiting a variant,
+     * but the dispatch is a switch over the index instead of a call through a table of function pointers.
+     *
+     * @tparam F The type of the visitor function or callable object.
+     * @tparam V The type of the tagged union to be visited.
+     * @param Visitor The visitor object or function to apply to the active alternative.
+     * @param Union The tagged union whose active alternative is being visited.
+     * @return The result of invoking the visitor on the active alternative.
+     */
+    RETROLIB_EXPORT template <typename F, TaggedUnionType V>
+    constexpr decltype(auto) VisitIndex(F &&Visitor, V &&Union) {
+        using UnionType = std::remove_reference_t<V>;
+        using FirstElement = std::conditional_t<std::is_const_v<UnionType>,
+                                                const typename UnionType::template TAlternative<0>,
+                                                typename UnionType::template TAlternative<0>>;
+        using ResultType = std::invoke_result_t<F, TIndexedElement<FirstElement, 0>>;
+        return Detail::VisitTaggedUnion<ResultType, 0>(std::forward<F>(Visitor), Union);
+    }
+
+    /**
+     * @brief Visits the active alternative of a tagged union by index, converting the result to the given type.
+     *
+     * The visitor is invoked with a TIndexedElement for the active alternative, the same as when visiting a variant,
+     * but the dispatch is a switch over the index instead of a call through a table of function pointers.
+     *
+     * @tparam R The type to return
+     * @tparam F The type of the visitor function or callable object.
+     * @tparam V The type of the tagged union to be visited.
+     * @param Visitor The visitor object or function to apply to the active alternative.
+     * @param Union The tagged union whose active alternative is being visited.
+     * @return The result of invoking the visitor on the active alternative.
+     */
+    RETROLIB_EXPORT template <typename R, typename F, TaggedUnionType V>
+    constexpr R VisitIndex(F &&Visitor, V &&Union) {
+        return Detail::VisitTaggedUnion<R, 0>(std::forward<F>(Visitor), Union);
+    }
+} // namespace Retro
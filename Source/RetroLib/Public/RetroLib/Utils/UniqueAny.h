@@ -10,11 +10,13 @@
 #include "RetroLib/Concepts/Inheritance.h"
 #include "RetroLib/Concepts/OpaqueStorage.h"
 #include "RetroLib/Optionals/OptionalOperations.h"
+#include "RetroLib/TypeTraits.h"
 
 #if !RETROLIB_WITH_MODULES
 #include <any>
 #include <array>
 #include <bit>
+#include <cstddef>
 #include <typeinfo>
 #include <utility>
 #endif
@@ -26,7 +28,7 @@
 namespace Retro {
 
     /**
-     * @class FUniqueAny
+     * @class TUniqueAny
      *
      * @brief A type-safe container for any single value of any type, which ensures unique ownership of the contained
      * value.
@@ -34,11 +36,26 @@ namespace Retro {
      * UniqueAny allows storing any object, while providing unique ownership semantics (non-copyable, movable).
      * It leverages small object optimization to store small objects directly inside the UniqueAny instance, and
      * dynamically allocates memory for larger objects.
+     *
+     * @tparam SmallStorageSize The size of the inline buffer used to store values without allocating.
+     * @tparam SmallStorageAlignment The alignment of the inline buffer. Values with a stricter alignment requirement
+     *                               are always allocated.
      */
-    RETROLIB_EXPORT class FUniqueAny final {
+    RETROLIB_EXPORT template <size_t SmallStorageSize = DEFAULT_SMALL_STORAGE_SIZE,
+                              size_t SmallStorageAlignment = alignof(void *)>
+        requires(SmallStorageSize >= sizeof(void *)) && (std::has_single_bit(SmallStorageAlignment))
+    class TUniqueAny final {
+      public:
+        /**
+         * Checks if a type can be stored inline in the small buffer. Types that do not fit are allocated on the heap
+         * instead.
+         *
+         * @tparam T The type to check
+         */
         template <typename T>
-        static constexpr bool FitsInSmallBuffer = sizeof(T) <= DEFAULT_SMALL_STORAGE_SIZE;
+        static constexpr bool FitsSmallStorage = sizeof(T) <= SmallStorageSize && alignof(T) <= SmallStorageAlignment;
 
+      private:
 #ifdef __UNREAL__
         template <typename T>
         using TOptionalType = TOptional<T>;
@@ -56,7 +73,7 @@ namespace Retro {
          * Initializes an empty UniqueAny instance. The object constructed with this constructor does not hold any
          * value.
          */
-        FUniqueAny() = default;
+        TUniqueAny() = default;
 
         /**
          * @brief Constructs an UniqueAny instance with a given value of any type.
@@ -68,8 +85,8 @@ namespace Retro {
          * @param Value The value to be stored inside the UniqueAny instance.
          */
         template <typename T>
-            requires(!std::same_as<std::decay_t<T>, FUniqueAny>)
-        explicit(false) FUniqueAny(T &&Value) noexcept
+            requires(!std::same_as<std::decay_t<T>, TUniqueAny>)
+        explicit(false) TUniqueAny(T &&Value) noexcept
             : Storage(std::forward<T>(Value)), Vtable(&GetVtableForType<std::decay_t<T>>()) {
         }
 
@@ -87,15 +104,15 @@ namespace Retro {
          */
         template <typename T, typename... A>
             requires std::constructible_from<T, A...>
-        explicit FUniqueAny(std::in_place_type_t<T>, A &&...Args) noexcept : Vtable(&GetVtableForType<T>()) {
-            if constexpr (FitsInSmallBuffer<T>) {
+        explicit TUniqueAny(std::in_place_type_t<T>, A &&...Args) noexcept : Vtable(&GetVtableForType<T>()) {
+            if constexpr (FitsSmallStorage<T>) {
                 new (std::bit_cast<T *>(Storage.SmallStorage.data())) T(std::forward<A>(Args)...);
             } else {
                 Storage.LargeStorage = new T(std::forward<A>(Args)...);
             }
         }
 
-        FUniqueAny(const FUniqueAny &) = delete;
+        TUniqueAny(const TUniqueAny &) = delete;
 
         /**
          * @brief Move constructor for UniqueAny.
@@ -103,12 +120,14 @@ namespace Retro {
          * Constructs an UniqueAny instance by transferring the ownership of the value from another UniqueAny
          * instance. The other instance will be left in an empty state after the move.
          *
+         * @note Heap allocated and trivially relocatable values are transferred by copying the storage, without going
+         *       through the vtable.
+         *
          * @param Other The UniqueAny instance to move from. The state of Other will be invalidated.
          * @return An UniqueAny instance that takes ownership of the value from the Other instance.
          */
-        FUniqueAny(FUniqueAny &&Other) noexcept : Vtable(Other.Vtable) {
-            Vtable->Move(Other.Storage, Storage);
-            Other.Vtable = nullptr;
+        TUniqueAny(TUniqueAny &&Other) noexcept {
+            RelocateFrom(Other);
         }
 
         /**
@@ -117,13 +136,13 @@ namespace Retro {
          * Cleans up the stored value, if any, by invoking the appropriate destruction logic through the virtual table.
          * Ensures that the dynamically allocated memory, if any, is properly deallocated.
          */
-        ~FUniqueAny() {
+        ~TUniqueAny() {
             if (Vtable != nullptr) {
                 Vtable->Destroy(Storage);
             }
         }
 
-        FUniqueAny &operator=(const FUniqueAny &) = delete;
+        TUniqueAny &operator=(const TUniqueAny &) = delete;
 
         /**
          * @brief Overloads the assignment operator to facilitate the correct transfer of ownership for the contained
@@ -135,10 +154,12 @@ namespace Retro {
          * @param Other The right-hand side UniqueAny instance from which the value is assigned.
          * @return A reference to the current UniqueAny instance after the assignment.
          */
-        FUniqueAny &operator=(FUniqueAny &&Other) noexcept {
-            Vtable = Other.Vtable;
-            Vtable->Move(Other.Storage, Storage);
-            Other.Vtable = nullptr;
+        TUniqueAny &operator=(TUniqueAny &&Other) noexcept {
+            if (this != &Other) {
+                Reset();
+                RelocateFrom(Other);
+            }
+
             return *this;
         }
 
@@ -152,7 +173,7 @@ namespace Retro {
          * @return A reference to this instance after assignment.
          */
         template <typename T>
-        FUniqueAny &operator=(T &&Other) noexcept {
+        TUniqueAny &operator=(T &&Other) noexcept {
             Emplace<std::decay_t<T>>(std::forward<T>(Other));
             return *this;
         }
@@ -249,7 +270,7 @@ namespace Retro {
                 Vtable->Destroy(Storage);
             }
 
-            if constexpr (FitsInSmallBuffer<std::decay_t<T>>) {
+            if constexpr (FitsSmallStorage<std::decay_t<T>>) {
                 new (std::bit_cast<T *>(Storage.SmallStorage.data())) std::decay_t<T>(std::forward<A>(Args)...);
             } else {
                 Storage.LargeStorage = new std::decay_t<T>(std::forward<A>(Args)...);
@@ -296,9 +317,22 @@ namespace Retro {
         }
 
       private:
+        void RelocateFrom(TUniqueAny &Other) noexcept {
+            Vtable = std::exchange(Other.Vtable, nullptr);
+            if (Vtable == nullptr) {
+                return;
+            }
+
+            if (Vtable->IsTriviallyRelocatable) {
+                Storage = Other.Storage;
+            } else {
+                Vtable->Move(Other.Storage, Storage);
+            }
+        }
+
         template <typename T>
         constexpr T &GetUnchecked() {
-            if constexpr (FitsInSmallBuffer<T>) {
+            if constexpr (FitsSmallStorage<T>) {
                 return *std::bit_cast<T *>(Storage.SmallStorage.data());
             } else {
                 return *static_cast<T *>(Storage.LargeStorage);
@@ -307,7 +341,7 @@ namespace Retro {
 
         template <typename T>
         constexpr const T &GetUnchecked() const {
-            if constexpr (FitsInSmallBuffer<T>) {
+            if constexpr (FitsSmallStorage<T>) {
                 return *std::bit_cast<const T *>(Storage.SmallStorage.data());
             } else {
                 return *static_cast<const T *>(Storage.LargeStorage);
@@ -315,25 +349,25 @@ namespace Retro {
         }
 
         union FValueStorage {
-            std::array<std::byte, DEFAULT_SMALL_STORAGE_SIZE> SmallStorage;
+            alignas(SmallStorageAlignment) std::array<std::byte, SmallStorageSize> SmallStorage;
             void *LargeStorage;
 
             FValueStorage() : LargeStorage(nullptr) {
             }
 
             template <typename T>
-                requires FitsInSmallBuffer<std::decay_t<T>> && (!std::same_as<std::decay_t<T>, FValueStorage>)
+                requires FitsSmallStorage<std::decay_t<T>> && (!std::same_as<std::decay_t<T>, FValueStorage>)
             explicit FValueStorage(T &&Data) noexcept {
                 new (std::bit_cast<std::decay_t<T> *>(SmallStorage.data())) std::decay_t<T>(std::forward<T>(Data));
             }
 
             template <typename T>
-                requires(!FitsInSmallBuffer<std::decay_t<T>>) && (!std::same_as<std::decay_t<T>, FValueStorage>)
+                requires(!FitsSmallStorage<std::decay_t<T>>) && (!std::same_as<std::decay_t<T>, FValueStorage>)
             explicit FValueStorage(T &&Data) noexcept : LargeStorage(new std::decay_t<T>(std::forward<T>(Data))) {
             }
 
             template <typename T>
-                requires(!FitsInSmallBuffer<std::decay_t<T>>)
+                requires(!FitsSmallStorage<std::decay_t<T>>)
             explicit FValueStorage(T *Data) noexcept : LargeStorage(Data) {
             }
         };
@@ -341,6 +375,7 @@ namespace Retro {
         struct FVTable {
             const std::type_info *Type;
             bool IsLarge = false;
+            bool IsTriviallyRelocatable = false;
             void (*Destroy)(FValueStorage &Storage);
             void (*Move)(FValueStorage &Source, FValueStorage &Dest) noexcept;
         };
@@ -348,7 +383,7 @@ namespace Retro {
         template <typename T>
         struct VTableImpl {
             static void Destroy(FValueStorage &Storage) noexcept {
-                if constexpr (FitsInSmallBuffer<T>) {
+                if constexpr (FitsSmallStorage<T>) {
                     std::bit_cast<T *>(Storage.SmallStorage.data())->~T();
                 } else {
                     delete static_cast<T *>(Storage.LargeStorage);
@@ -356,8 +391,10 @@ namespace Retro {
             }
 
             static void Move(FValueStorage &Source, FValueStorage &Dest) noexcept {
-                if constexpr (FitsInSmallBuffer<T>) {
-                    std::memcpy(&Dest.SmallStorage, &Source.SmallStorage, sizeof(T));
+                if constexpr (FitsSmallStorage<T>) {
+                    auto &SourceValue = *std::bit_cast<T *>(Source.SmallStorage.data());
+                    new (std::bit_cast<T *>(Dest.SmallStorage.data())) T(std::move(SourceValue));
+                    SourceValue.~T();
                 } else {
                     Dest.LargeStorage = Source.LargeStorage;
                     Source.LargeStorage = nullptr;
@@ -370,7 +407,9 @@ namespace Retro {
             // clang-format off
             static FVTable Vtable = {
                 .Type = &typeid(T),
-                .IsLarge = !FitsInSmallBuffer<T>,
+                .IsLarge = !FitsSmallStorage<T>,
+                // Relocating a heap allocated value only requires copying the pointer
+                .IsTriviallyRelocatable = !FitsSmallStorage<T> || IsTriviallyRelocatable<T>,
                 .Destroy = VTableImpl<T>::Destroy,
                 .Move = VTableImpl<T>::Move
             };
@@ -382,4 +421,9 @@ namespace Retro {
         FVTable *Vtable = nullptr;
     };
 
+    /**
+     * A UniqueAny that uses the default small buffer size and pointer alignment.
+     */
+    RETROLIB_EXPORT using FUniqueAny = TUniqueAny<>;
+
 } // namespace retro
\ No newline at end of file
@@ -0,0 +1,99 @@
+/**
+ * @file ReduceBenchmark.cpp
+ * @brief Benchmarks for reducing a range sequentially, with the vectorized kernels, with the parallel execution
+ * policy and fused with a transform.
+ *
+ * @author Retro & Chill
+ * https://github.com/retroandchill
+ */
+#include "BenchmarkUtils.h"
+
+#if RETROLIB_WITH_MODULES
+import std;
+import RetroLib;
+#else
+#include "RetroLib.h"
+
+#include <cstdint>
+#include <vector>
+#endif
+
+using namespace Retro::Benchmarks;
+
+// Parallel reduction only pays off once the range is large enough to amortize starting the threads, so this uses
+// larger sizes than the rest of the range benchmarks.
+static void ReduceSizes(benchmark::internal::Benchmark *Benchmark) {
+    Benchmark->RangeMultiplier(8)->Range(MIN_RANGE_SIZE, 1 << 24)->UseRealTime();
+}
+
+static void ReduceSequential(benchmark::State &State) {
+    auto Values = MakeValues<std::int64_t>(State.range(0));
+    for (auto _ : State) {
+        auto Result = Values | Retro::Ranges::Reduce<Retro::Add>(std::int64_t{0});
+        benchmark::DoNotOptimize(Result);
+    }
+    SetItemsProcessed(State);
+}
+
+static void ReduceParallel(benchmark::State &State) {
+    auto Values = MakeValues<std::int64_t>(State.range(0));
+    for (auto _ : State) {
+        auto Result = Values | Retro::Ranges::Reduce<Retro::Add>(Retro::Ranges::Par, std::int64_t{0});
+        benchmark::DoNotOptimize(Result);
+    }
+    SetItemsProcessed(State);
+}
+
+// Seq forces a strict left-to-right fold, which is the serial dependency chain the vectorized kernels replace
+template <typename T, auto Functor>
+static void ReduceStrict(benchmark::State &State) {
+    auto Values = MakeValues<T>(State.range(0));
+    for (auto _ : State) {
+        auto Result = Retro::Ranges::Reduce(Retro::Ranges::Seq, Values, T{0}, Functor);
+        benchmark::DoNotOptimize(Result);
+    }
+    SetItemsProcessed(State);
+}
+
+template <typename T, auto Functor>
+static void ReduceVectorized(benchmark::State &State) {
+    auto Values = MakeValues<T>(State.range(0));
+    for (auto _ : State) {
+        auto Result = Retro::Ranges::Reduce(Values, T{0}, Functor);
+        benchmark::DoNotOptimize(Result);
+    }
+    SetItemsProcessed(State);
+}
+
+static constexpr auto Square = [](auto Value) { return Value * Value; };
+
+template <typename T>
+static void TransformThenReduce(benchmark::State &State) {
+    auto Values = MakeValues<T>(State.range(0));
+    for (auto _ : State) {
+        auto Result = Values | Retro::Ranges::Views::Transform(Square) | Retro::Ranges::Reduce(T{0}, Retro::Add);
+        benchmark::DoNotOptimize(Result);
+    }
+    SetItemsProcessed(State);
+}
+
+template <typename T>
+static void TransformReduce(benchmark::State &State) {
+    auto Values = MakeValues<T>(State.range(0));
+    for (auto _ : State) {
+        auto Result = Values | Retro::Ranges::TransformReduce<Retro::Add, Square>(T{0});
+        benchmark::DoNotOptimize(Result);
+    }
+    SetItemsProcessed(State);
+}
+
+BENCHMARK(ReduceSequential)->Apply(ReduceSizes);
+BENCHMARK(ReduceParallel)->Apply(ReduceSizes);
+BENCHMARK_TEMPLATE(ReduceStrict, float, Retro::Add)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(ReduceVectorized, float, Retro::Add)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(ReduceStrict, double, Retro::Max)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(ReduceVectorized, double, Retro::Max)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(TransformThenReduce, float)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(TransformReduce, float)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(TransformThenReduce, std::int32_t)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(TransformReduce, std::int32_t)->Apply(RangeSizes);
@@ -0,0 +1,62 @@
+/**
+ * @file ReduceManyBenchmark.cpp
+ * @brief Benchmarks for computing several aggregates of a generated range, with one pass per aggregate and with
+ * ReduceMany.
+ *
+ * @author Retro & Chill
+ * https://github.com/retroandchill
+ */
+#if RETROLIB_WITH_COROUTINES
+#include "BenchmarkUtils.h"
+
+#if RETROLIB_WITH_MODULES
+import std;
+import RetroLib;
+#else
+#include "RetroLib.h"
+
+#include <limits>
+#endif
+
+using namespace Retro::Benchmarks;
+
+namespace {
+    Retro::TGenerator<std::int64_t> GenerateSamples(std::int64_t Count) {
+        for (std::int64_t i = 0; i < Count; i++) {
+            co_yield (i * 7919) % 1000;
+        }
+    }
+
+    constexpr auto CountSample = [](std::int64_t Total, std::int64_t) { return Total + 1; };
+} // namespace
+
+// A generator can only be traversed once, so each aggregate has to run the coroutine again
+static void SeparateReductions(benchmark::State &State) {
+    for (auto _ : State) {
+        auto Count = GenerateSamples(State.range(0)) | Retro::Ranges::Reduce(std::int64_t{0}, CountSample);
+        auto Sum = GenerateSamples(State.range(0)) | Retro::Ranges::Reduce<Retro::Add>(std::int64_t{0});
+        auto Lowest = GenerateSamples(State.range(0)) |
+                      Retro::Ranges::Reduce<Retro::Min>(std::numeric_limits<std::int64_t>::max());
+        auto Highest = GenerateSamples(State.range(0)) |
+                       Retro::Ranges::Reduce<Retro::Max>(std::numeric_limits<std::int64_t>::min());
+        benchmark::DoNotOptimize(Count + Sum + Lowest + Highest);
+    }
+    SetItemsProcessed(State);
+}
+
+static void SinglePassReduction(benchmark::State &State) {
+    for (auto _ : State) {
+        auto [Count, Sum, Lowest, Highest] =
+            GenerateSamples(State.range(0)) |
+            Retro::Ranges::ReduceMany(Retro::Ranges::Reducer(std::int64_t{0}, CountSample),
+                                      Retro::Ranges::Reducer<Retro::Add>(std::int64_t{0}),
+                                      Retro::Ranges::Reducer<Retro::Min>(std::numeric_limits<std::int64_t>::max()),
+                                      Retro::Ranges::Reducer<Retro::Max>(std::numeric_limits<std::int64_t>::min()));
+        benchmark::DoNotOptimize(Count + Sum + Lowest + Highest);
+    }
+    SetItemsProcessed(State);
+}
+
+BENCHMARK(SeparateReductions)->Apply(RangeSizes);
+BENCHMARK(SinglePassReduction)->Apply(RangeSizes);
+#endif
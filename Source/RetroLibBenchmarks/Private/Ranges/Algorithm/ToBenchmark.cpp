@@ -0,0 +1,131 @@
+/**
+ * @file ToBenchmark.cpp
+ * @brief Benchmarks for materializing a range into a container one element at a time, with a bulk append, into a
+ * reused container and into ordered maps.
+ *
+ * @author Retro & Chill
+ * https://github.com/retroandchill
+ */
+#include "BenchmarkUtils.h"
+
+#if RETROLIB_WITH_MODULES
+import std;
+import RetroLib;
+#else
+#include "RetroLib.h"
+
+#include <list>
+#include <map>
+#include <ranges>
+#include <span>
+#include <utility>
+#include <vector>
+#endif
+
+using namespace Retro::Benchmarks;
+
+// The baseline that To used for every range: reserve up front, then append each element individually
+static void ToPerElement(benchmark::State &State) {
+    auto Values = MakeValues<float>(State.range(0));
+    std::span<const float> Source = Values;
+    for (auto _ : State) {
+        std::vector<float> Result;
+        Result.reserve(Source.size());
+        for (float Value : Source) {
+            Retro::Ranges::AppendContainer(Result, Value);
+        }
+        benchmark::DoNotOptimize(Result.data());
+    }
+    SetItemsProcessed(State);
+}
+
+static void ToFromSpan(benchmark::State &State) {
+    auto Values = MakeValues<float>(State.range(0));
+    std::span<const float> Source = Values;
+    for (auto _ : State) {
+        auto Result = Source | Retro::Ranges::To<std::vector>();
+        benchmark::DoNotOptimize(Result.data());
+    }
+    SetItemsProcessed(State);
+}
+
+static void ToFromList(benchmark::State &State) {
+    auto Values = MakeValues<std::int64_t>(State.range(0));
+    std::list<std::int64_t> Source(Values.begin(), Values.end());
+    for (auto _ : State) {
+        auto Result = Source | Retro::Ranges::To<std::vector>();
+        benchmark::DoNotOptimize(Result.data());
+    }
+    SetItemsProcessed(State);
+}
+
+// Simulates a per-frame pipeline that builds a fresh container every tick
+static void ToEveryFrame(benchmark::State &State) {
+    auto Values = MakeValues<std::int64_t>(State.range(0));
+    auto IsEven = [](std::int64_t Value) { return Value % 2 == 0; };
+    for (auto _ : State) {
+        auto Result = Values | std::views::filter(IsEven) | Retro::Ranges::To<std::vector>();
+        benchmark::DoNotOptimize(Result.data());
+    }
+    SetItemsProcessed(State);
+}
+
+static void AssignToEveryFrame(benchmark::State &State) {
+    auto Values = MakeValues<std::int64_t>(State.range(0));
+    auto IsEven = [](std::int64_t Value) { return Value % 2 == 0; };
+    std::vector<std::int64_t> Scratch;
+    for (auto _ : State) {
+        Values | std::views::filter(IsEven) | Retro::Ranges::AssignTo(Scratch);
+        benchmark::DoNotOptimize(Scratch.data());
+    }
+    SetItemsProcessed(State);
+}
+
+static std::vector<std::pair<std::int64_t, std::int64_t>> MakeShuffledPairs(std::int64_t Count) {
+    std::vector<std::pair<std::int64_t, std::int64_t>> Result;
+    Result.reserve(static_cast<size_t>(Count));
+    for (std::int64_t i = 0; i < Count; i++) {
+        Result.emplace_back((i * 7919) % Count, i);
+    }
+    return Result;
+}
+
+// The baseline that To used for maps: every element walks the tree to find where it goes
+static void ToMapInsertEach(benchmark::State &State) {
+    auto Pairs = MakeShuffledPairs(State.range(0));
+    for (auto _ : State) {
+        std::map<std::int64_t, std::int64_t> Result;
+        for (const auto &Pair : Pairs) {
+            Result.emplace(Pair);
+        }
+        benchmark::DoNotOptimize(Result.size());
+    }
+    SetItemsProcessed(State);
+}
+
+static void ToMapSorted(benchmark::State &State) {
+    auto Pairs = MakeShuffledPairs(State.range(0));
+    for (auto _ : State) {
+        auto Result = Pairs | Retro::Ranges::To<std::map<std::int64_t, std::int64_t>>();
+        benchmark::DoNotOptimize(Result.size());
+    }
+    SetItemsProcessed(State);
+}
+
+static void ToFlatMap(benchmark::State &State) {
+    auto Pairs = MakeShuffledPairs(State.range(0));
+    for (auto _ : State) {
+        auto Result = Pairs | Retro::Ranges::To<Retro::TFlatMap>();
+        benchmark::DoNotOptimize(Result.size());
+    }
+    SetItemsProcessed(State);
+}
+
+BENCHMARK(ToPerElement)->Apply(RangeSizes);
+BENCHMARK(ToFromSpan)->Apply(RangeSizes);
+BENCHMARK(ToFromList)->Apply(RangeSizes);
+BENCHMARK(ToEveryFrame)->Apply(RangeSizes);
+BENCHMARK(AssignToEveryFrame)->Apply(RangeSizes);
+BENCHMARK(ToMapInsertEach)->Apply(RangeSizes);
+BENCHMARK(ToMapSorted)->Apply(RangeSizes);
+BENCHMARK(ToFlatMap)->Apply(RangeSizes);
@@ -0,0 +1,121 @@
+/**
+ * @file AnyViewBenchmark.cpp
+ * @brief Benchmarks for iterating over a type-erased TAnyView.
+ *
+ * @author Retro & Chill
+ * https://github.com/retroandchill
+ */
+#include "BenchmarkUtils.h"
+
+#if RETROLIB_WITH_MODULES
+import std;
+import RetroLib;
+#else
+#include "RetroLib.h"
+
+#include <string>
+#include <vector>
+#endif
+
+using namespace Retro::Benchmarks;
+
+template <typename T>
+static void AnyViewHandWritten(benchmark::State &State) {
+    auto Values = MakeValues<T>(State.range(0));
+    for (auto _ : State) {
+        std::int64_t Sum = 0;
+        for (const auto &Value : Values) {
+            Sum += Weigh(Value);
+        }
+        benchmark::DoNotOptimize(Sum);
+    }
+    SetItemsProcessed(State);
+}
+
+template <typename T>
+static void AnyViewStdAll(benchmark::State &State) {
+    auto Values = MakeValues<T>(State.range(0));
+    auto View = std::ranges::views::all(Values);
+    for (auto _ : State) {
+        std::int64_t Sum = 0;
+        for (const auto &Value : View) {
+            Sum += Weigh(Value);
+        }
+        benchmark::DoNotOptimize(Sum);
+    }
+    SetItemsProcessed(State);
+}
+
+template <typename T>
+static void AnyViewRetro(benchmark::State &State) {
+    auto Values = MakeValues<T>(State.range(0));
+    Retro::Ranges::TAnyView<T> View = std::ranges::views::all(Values);
+    for (auto _ : State) {
+        std::int64_t Sum = 0;
+        for (const auto &Value : View) {
+            Sum += Weigh(Value);
+        }
+        benchmark::DoNotOptimize(Sum);
+    }
+    SetItemsProcessed(State);
+}
+
+template <typename T>
+static void AnyViewStdPipeline(benchmark::State &State) {
+    auto Values = MakeValues<T>(State.range(0));
+    auto View = Values | std::ranges::views::filter([](const T &Value) { return Weigh(Value) % 2 == 0; }) |
+                std::ranges::views::transform([](const T &Value) { return Value + Value; });
+    for (auto _ : State) {
+        std::int64_t Sum = 0;
+        for (const auto &Value : View) {
+            Sum += Weigh(Value);
+        }
+        benchmark::DoNotOptimize(Sum);
+    }
+    SetItemsProcessed(State);
+}
+
+template <typename T>
+static void AnyViewRetroPipeline(benchmark::State &State) {
+    auto Values = MakeValues<T>(State.range(0));
+    Retro::Ranges::TAnyView<T> View =
+        Values | std::ranges::views::filter([](const T &Value) { return Weigh(Value) % 2 == 0; }) |
+        std::ranges::views::transform([](const T &Value) { return Value + Value; });
+    for (auto _ : State) {
+        std::int64_t Sum = 0;
+        for (const auto &Value : View) {
+            Sum += Weigh(Value);
+        }
+        benchmark::DoNotOptimize(Sum);
+    }
+    SetItemsProcessed(State);
+}
+
+template <typename T>
+static void AnyViewPipelineToVector(benchmark::State &State) {
+    auto Values = MakeValues<T>(State.range(0));
+    Retro::Ranges::TAnyView<T> View =
+        Values | std::ranges::views::filter([](const T &Value) { return Weigh(Value) % 2 == 0; }) |
+        std::ranges::views::transform([](const T &Value) { return Value + Value; });
+    for (auto _ : State) {
+        auto Result = View | Retro::Ranges::To<std::vector>();
+        benchmark::DoNotOptimize(Result.data());
+    }
+    SetItemsProcessed(State);
+}
+
+BENCHMARK_TEMPLATE(AnyViewHandWritten, int)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(AnyViewStdAll, int)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(AnyViewRetro, int)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(AnyViewStdPipeline, int)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(AnyViewRetroPipeline, int)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(AnyViewPipelineToVector, int)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(AnyViewHandWritten, double)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(AnyViewStdAll, double)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(AnyViewRetro, double)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(AnyViewStdPipeline, double)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(AnyViewRetroPipeline, double)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(AnyViewPipelineToVector, double)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(AnyViewHandWritten, std::string)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(AnyViewStdAll, std::string)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(AnyViewRetro, std::string)->Apply(RangeSizes);
@@ -0,0 +1,76 @@
+/**
+ * @file CacheLastBenchmark.cpp
+ * @brief Benchmarks for iterating over a TCacheLastView.
+ *
+ * @author Retro & Chill
+ * https://github.com/retroandchill
+ */
+#include "BenchmarkUtils.h"
+
+#if RETROLIB_WITH_MODULES
+import std;
+import RetroLib;
+#else
+#include "RetroLib.h"
+
+#include <string>
+#include <vector>
+#endif
+
+using namespace Retro::Benchmarks;
+
+template <typename T>
+static auto MakeTransformer() {
+    return [](const T &Value) { return Value + Value; };
+}
+
+template <typename T>
+static void CacheLastHandWritten(benchmark::State &State) {
+    auto Values = MakeValues<T>(State.range(0));
+    auto Transformer = MakeTransformer<T>();
+    for (auto _ : State) {
+        std::int64_t Sum = 0;
+        for (const auto &Value : Values) {
+            Sum += Weigh(Transformer(Value));
+        }
+        benchmark::DoNotOptimize(Sum);
+    }
+    SetItemsProcessed(State);
+}
+
+template <typename T>
+static void CacheLastStdTransform(benchmark::State &State) {
+    auto Values = MakeValues<T>(State.range(0));
+    for (auto _ : State) {
+        std::int64_t Sum = 0;
+        for (auto &&Value : Values | std::ranges::views::transform(MakeTransformer<T>())) {
+            Sum += Weigh(Value);
+        }
+        benchmark::DoNotOptimize(Sum);
+    }
+    SetItemsProcessed(State);
+}
+
+template <typename T>
+static void CacheLastRetro(benchmark::State &State) {
+    auto Values = MakeValues<T>(State.range(0));
+    for (auto _ : State) {
+        std::int64_t Sum = 0;
+        for (auto &&Value :
+             Values | std::ranges::views::transform(MakeTransformer<T>()) | Retro::Ranges::Views::CacheLast) {
+            Sum += Weigh(Value);
+        }
+        benchmark::DoNotOptimize(Sum);
+    }
+    SetItemsProcessed(State);
+}
+
+BENCHMARK_TEMPLATE(CacheLastHandWritten, int)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(CacheLastStdTransform, int)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(CacheLastRetro, int)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(CacheLastHandWritten, double)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(CacheLastStdTransform, double)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(CacheLastRetro, double)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(CacheLastHandWritten, std::string)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(CacheLastStdTransform, std::string)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(CacheLastRetro, std::string)->Apply(RangeSizes);
@@ -0,0 +1,235 @@
+/**
+ * @file ConcatBenchmark.cpp
+ * @brief Benchmarks for iterating over a TConcatView.
+ *
+ * @author Retro & Chill
+ * https://github.com/retroandchill
+ */
+#include "BenchmarkUtils.h"
+
+#if RETROLIB_WITH_MODULES
+import std;
+import RetroLib;
+#else
+#include "RetroLib.h"
+
+#include <array>
+#include <span>
+#include <string>
+#include <vector>
+#endif
+
+using namespace Retro::Benchmarks;
+
+// Baseline for the cost of each element, with every value in one buffer and no segments at all
+template <typename T>
+static void ConcatFlat(benchmark::State &State) {
+    auto Values = MakeValues<T>(State.range(0));
+    for (auto _ : State) {
+        std::int64_t Sum = 0;
+        for (const auto &Value : Values) {
+            Sum += Weigh(Value);
+        }
+        benchmark::DoNotOptimize(Sum);
+    }
+    SetItemsProcessed(State);
+}
+
+template <typename T>
+static void ConcatHandWritten(benchmark::State &State) {
+    auto First = MakeValues<T>(State.range(0) / 2);
+    auto Second = MakeValues<T>(State.range(0) - State.range(0) / 2);
+    for (auto _ : State) {
+        std::int64_t Sum = 0;
+        for (const auto &Value : First) {
+            Sum += Weigh(Value);
+        }
+        for (const auto &Value : Second) {
+            Sum += Weigh(Value);
+        }
+        benchmark::DoNotOptimize(Sum);
+    }
+    SetItemsProcessed(State);
+}
+
+template <typename T>
+static void ConcatStdJoin(benchmark::State &State) {
+    auto First = MakeValues<T>(State.range(0) / 2);
+    auto Second = MakeValues<T>(State.range(0) - State.range(0) / 2);
+    std::array<std::span<const T>, 2> Segments = {First, Second};
+    for (auto _ : State) {
+        std::int64_t Sum = 0;
+        for (const auto &Value : Segments | std::ranges::views::join) {
+            Sum += Weigh(Value);
+        }
+        benchmark::DoNotOptimize(Sum);
+    }
+    SetItemsProcessed(State);
+}
+
+template <typename T>
+static void ConcatRetro(benchmark::State &State) {
+    auto First = MakeValues<T>(State.range(0) / 2);
+    auto Second = MakeValues<T>(State.range(0) - State.range(0) / 2);
+    for (auto _ : State) {
+        std::int64_t Sum = 0;
+        for (const auto &Value : Retro::Ranges::Views::Concat(First, Second)) {
+            Sum += Weigh(Value);
+        }
+        benchmark::DoNotOptimize(Sum);
+    }
+    SetItemsProcessed(State);
+}
+
+// The ranges have different iterator types, so the iterator has to dispatch on the active range
+template <typename T>
+static void ConcatRetroMixed(benchmark::State &State) {
+    auto First = MakeValues<T>(State.range(0) / 2);
+    auto Second = MakeValues<T>(State.range(0) - State.range(0) / 2);
+    for (auto _ : State) {
+        std::int64_t Sum = 0;
+        for (const auto &Value : Retro::Ranges::Views::Concat(First, std::span<const T>(Second))) {
+            Sum += Weigh(Value);
+        }
+        benchmark::DoNotOptimize(Sum);
+    }
+    SetItemsProcessed(State);
+}
+
+template <typename T>
+static void ConcatRetroSegmented(benchmark::State &State) {
+    auto First = MakeValues<T>(State.range(0) / 2);
+    auto Second = MakeValues<T>(State.range(0) - State.range(0) / 2);
+    for (auto _ : State) {
+        std::int64_t Sum = 0;
+        Retro::Ranges::ForEachSegment(Retro::Ranges::Views::Concat(First, Second), [&Sum](auto &Segment) {
+            for (const auto &Value : Segment) {
+                Sum += Weigh(Value);
+            }
+            return true;
+        });
+        benchmark::DoNotOptimize(Sum);
+    }
+    SetItemsProcessed(State);
+}
+
+template <typename T>
+static void ConcatRetroReduce(benchmark::State &State) {
+    auto First = MakeValues<T>(State.range(0) / 2);
+    auto Second = MakeValues<T>(State.range(0) - State.range(0) / 2);
+    for (auto _ : State) {
+        auto Sum = Retro::Ranges::Views::Concat(First, Second) |
+                   Retro::Ranges::TransformReduce(std::int64_t{0}, Retro::Add, [](const T &Value) {
+                       return Weigh(Value);
+                   });
+        benchmark::DoNotOptimize(Sum);
+    }
+    SetItemsProcessed(State);
+}
+
+/**
+ * The number of buffers used by the benchmarks over many segments, such as the output of one job per thread.
+ */
+static constexpr std::int64_t CONCAT_ALL_SEGMENTS = 8;
+
+static std::vector<std::vector<int>> MakeSegments(std::int64_t Size) {
+    std::vector<std::vector<int>> Segments;
+    for (std::int64_t i = 0; i < CONCAT_ALL_SEGMENTS; i++) {
+        Segments.push_back(MakeValues<int>(Size / CONCAT_ALL_SEGMENTS));
+    }
+    return Segments;
+}
+
+static void ConcatRetroIndexed(benchmark::State &State) {
+    auto Buffers = MakeSegments(State.range(0));
+    auto View = Retro::Ranges::Views::Concat(Buffers[0], Buffers[1], Buffers[2], Buffers[3], Buffers[4], Buffers[5],
+                                             Buffers[6], Buffers[7]);
+    auto Size = static_cast<std::ptrdiff_t>(View.size());
+    for (auto _ : State) {
+        int Sum = 0;
+        // Samples with a stride that lands in a different segment most of the time
+        for (std::ptrdiff_t i = 0; i < Size; i++) {
+            Sum += View[i * 7919 % Size];
+        }
+        benchmark::DoNotOptimize(Sum);
+    }
+    SetItemsProcessed(State);
+}
+
+static void ConcatAllHandWritten(benchmark::State &State) {
+    auto Segments = MakeSegments(State.range(0));
+    for (auto _ : State) {
+        int Sum = 0;
+        for (const auto &Segment : Segments) {
+            for (int Value : Segment) {
+                Sum += Value;
+            }
+        }
+        benchmark::DoNotOptimize(Sum);
+    }
+    SetItemsProcessed(State);
+}
+
+static void ConcatAllStdJoin(benchmark::State &State) {
+    auto Segments = MakeSegments(State.range(0));
+    for (auto _ : State) {
+        int Sum = 0;
+        for (int Value : Segments | std::ranges::views::join) {
+            Sum += Value;
+        }
+        benchmark::DoNotOptimize(Sum);
+    }
+    SetItemsProcessed(State);
+}
+
+static void ConcatAllRetroReduce(benchmark::State &State) {
+    auto Segments = MakeSegments(State.range(0));
+    for (auto _ : State) {
+        auto Sum = Segments | Retro::Ranges::Views::ConcatAll | Retro::Ranges::Reduce(0, Retro::Add);
+        benchmark::DoNotOptimize(Sum);
+    }
+    SetItemsProcessed(State);
+}
+
+static void ConcatAllRetroIndexed(benchmark::State &State) {
+    auto Segments = MakeSegments(State.range(0));
+    auto View = Retro::Ranges::Views::ConcatAll(Segments);
+    auto Size = static_cast<std::ptrdiff_t>(View.size());
+    for (auto _ : State) {
+        int Sum = 0;
+        // Samples with a stride that lands in a different segment most of the time
+        for (std::ptrdiff_t i = 0; i < Size; i++) {
+            Sum += View[i * 7919 % Size];
+        }
+        benchmark::DoNotOptimize(Sum);
+    }
+    SetItemsProcessed(State);
+}
+
+BENCHMARK(ConcatAllHandWritten)->Apply(RangeSizes);
+BENCHMARK(ConcatAllStdJoin)->Apply(RangeSizes);
+BENCHMARK(ConcatAllRetroReduce)->Apply(RangeSizes);
+BENCHMARK(ConcatAllRetroIndexed)->Apply(RangeSizes);
+BENCHMARK(ConcatRetroIndexed)->Apply(RangeSizes);
+
+BENCHMARK_TEMPLATE(ConcatFlat, int)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(ConcatHandWritten, int)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(ConcatStdJoin, int)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(ConcatRetro, int)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(ConcatRetroMixed, int)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(ConcatRetroSegmented, int)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(ConcatRetroReduce, int)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(ConcatFlat, double)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(ConcatHandWritten, double)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(ConcatStdJoin, double)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(ConcatRetro, double)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(ConcatRetroMixed, double)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(ConcatRetroSegmented, double)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(ConcatRetroReduce, double)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(ConcatFlat, std::string)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(ConcatHandWritten, std::string)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(ConcatStdJoin, std::string)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(ConcatRetro, std::string)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(ConcatRetroMixed, std::string)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(ConcatRetroSegmented, std::string)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(ConcatRetroReduce, std::string)->Apply(RangeSizes);
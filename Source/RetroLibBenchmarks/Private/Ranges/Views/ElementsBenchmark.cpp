@@ -0,0 +1,80 @@
+/**
+ * @file ElementsBenchmark.cpp
+ * @brief Benchmarks for iterating over a TElementsView.
+ *
+ * @author Retro & Chill
+ * https://github.com/retroandchill
+ */
+#include "BenchmarkUtils.h"
+
+#if RETROLIB_WITH_MODULES
+import std;
+import RetroLib;
+#else
+#include "RetroLib.h"
+
+#include <string>
+#include <tuple>
+#include <vector>
+#endif
+
+using namespace Retro::Benchmarks;
+
+template <typename T>
+static std::vector<std::tuple<std::int64_t, T>> MakeTuples(std::int64_t Count) {
+    std::vector<std::tuple<std::int64_t, T>> Result;
+    Result.reserve(static_cast<size_t>(Count));
+    for (std::int64_t i = 0; i < Count; i++) {
+        Result.emplace_back(i, MakeValue<T>(i));
+    }
+    return Result;
+}
+
+template <typename T>
+static void ElementsHandWritten(benchmark::State &State) {
+    auto Tuples = MakeTuples<T>(State.range(0));
+    for (auto _ : State) {
+        std::int64_t Sum = 0;
+        for (const auto &Tuple : Tuples) {
+            Sum += Weigh(std::get<1>(Tuple));
+        }
+        benchmark::DoNotOptimize(Sum);
+    }
+    SetItemsProcessed(State);
+}
+
+template <typename T>
+static void ElementsStd(benchmark::State &State) {
+    auto Tuples = MakeTuples<T>(State.range(0));
+    for (auto _ : State) {
+        std::int64_t Sum = 0;
+        for (const auto &Value : Tuples | std::ranges::views::elements<1>) {
+            Sum += Weigh(Value);
+        }
+        benchmark::DoNotOptimize(Sum);
+    }
+    SetItemsProcessed(State);
+}
+
+template <typename T>
+static void ElementsRetro(benchmark::State &State) {
+    auto Tuples = MakeTuples<T>(State.range(0));
+    for (auto _ : State) {
+        std::int64_t Sum = 0;
+        for (const auto &Value : Tuples | Retro::Ranges::Views::Elements<1>) {
+            Sum += Weigh(Value);
+        }
+        benchmark::DoNotOptimize(Sum);
+    }
+    SetItemsProcessed(State);
+}
+
+BENCHMARK_TEMPLATE(ElementsHandWritten, int)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(ElementsStd, int)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(ElementsRetro, int)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(ElementsHandWritten, double)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(ElementsStd, double)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(ElementsRetro, double)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(ElementsHandWritten, std::string)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(ElementsStd, std::string)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(ElementsRetro, std::string)->Apply(RangeSizes);
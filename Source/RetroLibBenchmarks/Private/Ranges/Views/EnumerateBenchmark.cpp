@@ -0,0 +1,110 @@
+/**
+ * @file EnumerateBenchmark.cpp
+ * @brief Benchmarks for iterating over a TEnumerateView and a TReverseEnumerateView.
+ *
+ * @author Retro & Chill
+ * https://github.com/retroandchill
+ */
+#include "BenchmarkUtils.h"
+
+#if RETROLIB_WITH_MODULES
+import std;
+import RetroLib;
+#else
+#include "RetroLib.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+#endif
+
+using namespace Retro::Benchmarks;
+
+template <typename T>
+static void EnumerateHandWritten(benchmark::State &State) {
+    auto Values = MakeValues<T>(State.range(0));
+    for (auto _ : State) {
+        std::int64_t Sum = 0;
+        for (size_t i = 0; i < Values.size(); i++) {
+            Sum += static_cast<std::int64_t>(i) + Weigh(Values[i]);
+        }
+        benchmark::DoNotOptimize(Sum);
+    }
+    SetItemsProcessed(State);
+}
+
+// C++20 has no enumerate adapter, so the closest standard equivalent for both views is an index range transformed into
+// index/value pairs.
+template <typename T>
+static void EnumerateStdTransform(benchmark::State &State) {
+    auto Values = MakeValues<T>(State.range(0));
+    auto View = std::ranges::views::iota(std::ptrdiff_t{0}, std::ranges::ssize(Values)) |
+                std::ranges::views::transform([&Values](std::ptrdiff_t i) {
+                    return std::pair<std::ptrdiff_t, const T &>(i, Values[static_cast<size_t>(i)]);
+                });
+    for (auto _ : State) {
+        std::int64_t Sum = 0;
+        for (auto [Index, Value] : View) {
+            Sum += Index + Weigh(Value);
+        }
+        benchmark::DoNotOptimize(Sum);
+    }
+    SetItemsProcessed(State);
+}
+
+template <typename T>
+static void EnumerateRetro(benchmark::State &State) {
+    auto Values = MakeValues<T>(State.range(0));
+    for (auto _ : State) {
+        std::int64_t Sum = 0;
+        for (auto [Index, Value] : Values | Retro::Ranges::Views::Enumerate) {
+            Sum += Index + Weigh(Value);
+        }
+        benchmark::DoNotOptimize(Sum);
+    }
+    SetItemsProcessed(State);
+}
+
+template <typename T>
+static void ReverseEnumerateHandWritten(benchmark::State &State) {
+    auto Values = MakeValues<T>(State.range(0));
+    for (auto _ : State) {
+        std::int64_t Sum = 0;
+        for (std::ptrdiff_t i = 0; i < std::ranges::ssize(Values); i++) {
+            Sum += i + Weigh(Values[static_cast<size_t>(i)]);
+        }
+        benchmark::DoNotOptimize(Sum);
+    }
+    SetItemsProcessed(State);
+}
+
+template <typename T>
+static void ReverseEnumerateRetro(benchmark::State &State) {
+    auto Values = MakeValues<T>(State.range(0));
+    for (auto _ : State) {
+        std::int64_t Sum = 0;
+        for (auto [Index, Value] : std::ranges::views::iota(std::ptrdiff_t{0}, std::ranges::ssize(Values)) |
+                                       Retro::Ranges::Views::ReverseEnumerate(Values)) {
+            Sum += Index + Weigh(Value);
+        }
+        benchmark::DoNotOptimize(Sum);
+    }
+    SetItemsProcessed(State);
+}
+
+BENCHMARK_TEMPLATE(EnumerateHandWritten, int)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(EnumerateStdTransform, int)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(EnumerateRetro, int)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(EnumerateHandWritten, double)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(EnumerateStdTransform, double)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(EnumerateRetro, double)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(EnumerateHandWritten, std::string)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(EnumerateStdTransform, std::string)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(EnumerateRetro, std::string)->Apply(RangeSizes);
+
+BENCHMARK_TEMPLATE(ReverseEnumerateHandWritten, int)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(ReverseEnumerateRetro, int)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(ReverseEnumerateHandWritten, double)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(ReverseEnumerateRetro, double)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(ReverseEnumerateHandWritten, std::string)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(ReverseEnumerateRetro, std::string)->Apply(RangeSizes);
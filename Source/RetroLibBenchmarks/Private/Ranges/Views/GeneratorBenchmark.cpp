@@ -0,0 +1,53 @@
+/**
+ * @file GeneratorBenchmark.cpp
+ * @brief Benchmarks for creating and draining short-lived generators, with and without the frame pool.
+ *
+ * @author Retro & Chill
+ * https://github.com/retroandchill
+ */
+#if RETROLIB_WITH_COROUTINES
+#include "BenchmarkUtils.h"
+
+#if RETROLIB_WITH_MODULES
+import std;
+import RetroLib;
+#else
+#include "RetroLib.h"
+#endif
+
+using namespace Retro::Benchmarks;
+
+namespace {
+    constexpr std::int64_t VALUES_PER_GENERATOR = 4;
+
+    Retro::TGenerator<std::int64_t> GenerateHeap(std::int64_t Start) {
+        for (std::int64_t i = 0; i < VALUES_PER_GENERATOR; i++) {
+            co_yield Start + i;
+        }
+    }
+
+    Retro::TPooledGenerator<std::int64_t> GeneratePooled(std::int64_t Start) {
+        for (std::int64_t i = 0; i < VALUES_PER_GENERATOR; i++) {
+            co_yield Start + i;
+        }
+    }
+} // namespace
+
+// Mimics creating one small generator per entity every frame, where the cost is dominated by the frame allocation
+template <auto Generate>
+static void ShortLivedGenerators(benchmark::State &State) {
+    for (auto _ : State) {
+        std::int64_t Sum = 0;
+        for (std::int64_t i = 0; i < State.range(0); i++) {
+            for (auto Value : Generate(i)) {
+                Sum += Value;
+            }
+        }
+        benchmark::DoNotOptimize(Sum);
+    }
+    SetItemsProcessed(State);
+}
+
+BENCHMARK_TEMPLATE(ShortLivedGenerators, GenerateHeap)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(ShortLivedGenerators, GeneratePooled)->Apply(RangeSizes);
+#endif
@@ -0,0 +1,200 @@
+/**
+ * @file JoinWithBenchmark.cpp
+ * @brief Benchmarks for iterating over and materializing a TJoinWithView.
+ *
+ * @author Retro & Chill
+ * https://github.com/retroandchill
+ */
+#include "BenchmarkUtils.h"
+
+#if RETROLIB_WITH_MODULES
+import std;
+import RetroLib;
+#else
+#include "RetroLib.h"
+
+#include <string>
+#include <string_view>
+#include <vector>
+#endif
+
+using namespace Retro::Benchmarks;
+
+/**
+ * The number of elements in each inner range of the nested benchmarks.
+ */
+constexpr std::int64_t INNER_SIZE = 8;
+
+template <typename T>
+static std::vector<std::vector<T>> MakeNestedValues(std::int64_t Count) {
+    std::vector<std::vector<T>> Result;
+    for (std::int64_t i = 0; i < Count; i += INNER_SIZE) {
+        auto &Inner = Result.emplace_back();
+        for (std::int64_t j = i; j < std::min(i + INNER_SIZE, Count); j++) {
+            Inner.push_back(MakeValue<T>(j));
+        }
+    }
+    return Result;
+}
+
+// Baseline for the cost of each element, with every value in one buffer and no separators at all
+template <typename T>
+static void JoinWithFlat(benchmark::State &State) {
+    auto Values = MakeValues<T>(State.range(0));
+    for (auto _ : State) {
+        std::int64_t Sum = 0;
+        for (const auto &Value : Values) {
+            Sum += Weigh(Value);
+        }
+        benchmark::DoNotOptimize(Sum);
+    }
+    SetItemsProcessed(State);
+}
+
+template <typename T>
+static void JoinWithHandWritten(benchmark::State &State) {
+    auto Values = MakeNestedValues<T>(State.range(0));
+    auto Separator = MakeValue<T>(-1);
+    for (auto _ : State) {
+        std::int64_t Sum = 0;
+        bool First = true;
+        for (const auto &Inner : Values) {
+            if (!First) {
+                Sum += Weigh(Separator);
+            }
+            First = false;
+            for (const auto &Value : Inner) {
+                Sum += Weigh(Value);
+            }
+        }
+        benchmark::DoNotOptimize(Sum);
+    }
+    SetItemsProcessed(State);
+}
+
+// C++20 has no join_with adapter, so the standard baseline flattens without the separator.
+template <typename T>
+static void JoinWithStdJoin(benchmark::State &State) {
+    auto Values = MakeNestedValues<T>(State.range(0));
+    for (auto _ : State) {
+        std::int64_t Sum = 0;
+        for (const auto &Value : Values | std::ranges::views::join) {
+            Sum += Weigh(Value);
+        }
+        benchmark::DoNotOptimize(Sum);
+    }
+    SetItemsProcessed(State);
+}
+
+template <typename T>
+static void JoinWithRetro(benchmark::State &State) {
+    auto Values = MakeNestedValues<T>(State.range(0));
+    auto Separator = MakeValue<T>(-1);
+    for (auto _ : State) {
+        std::int64_t Sum = 0;
+        for (const auto &Value : Values | Retro::Ranges::Views::JoinWith(Separator)) {
+            Sum += Weigh(Value);
+        }
+        benchmark::DoNotOptimize(Sum);
+    }
+    SetItemsProcessed(State);
+}
+
+// The separator is a range with the same iterator type as the inner ranges, so only one iterator is stored
+template <typename T>
+static void JoinWithRetroSharedIterator(benchmark::State &State) {
+    auto Values = MakeNestedValues<T>(State.range(0));
+    std::vector<T> Separator = {MakeValue<T>(-1)};
+    for (auto _ : State) {
+        std::int64_t Sum = 0;
+        for (const auto &Value : Values | Retro::Ranges::Views::JoinWith(Separator)) {
+            Sum += Weigh(Value);
+        }
+        benchmark::DoNotOptimize(Sum);
+    }
+    SetItemsProcessed(State);
+}
+
+static void JoinWithToStringHandWritten(benchmark::State &State) {
+    auto Values = MakeValues<std::string>(State.range(0));
+    for (auto _ : State) {
+        std::string Result;
+        bool First = true;
+        for (const auto &Value : Values) {
+            if (!First) {
+                Result.append(", ");
+            }
+            First = false;
+            Result.append(Value);
+        }
+        benchmark::DoNotOptimize(Result);
+    }
+    SetItemsProcessed(State);
+}
+
+// Measures the whole output up front, which is what the Retro version does for a multi-pass range of strings
+static void JoinWithToStringExactHandWritten(benchmark::State &State) {
+    using namespace std::literals;
+    auto Values = MakeValues<std::string>(State.range(0));
+    auto Separator = ", "sv;
+    for (auto _ : State) {
+        std::string Result;
+        if (!Values.empty()) {
+            std::size_t Size = (Values.size() - 1) * Separator.size();
+            for (const auto &Value : Values) {
+                Size += Value.size();
+            }
+            Result.reserve(Size);
+        }
+
+        bool First = true;
+        for (const auto &Value : Values) {
+            if (!First) {
+                Result.append(Separator);
+            }
+            First = false;
+            Result.append(Value);
+        }
+        benchmark::DoNotOptimize(Result);
+    }
+    SetItemsProcessed(State);
+}
+
+static void JoinWithToStringRetro(benchmark::State &State) {
+    using namespace std::literals;
+    auto Values = MakeValues<std::string>(State.range(0));
+    for (auto _ : State) {
+        auto Result = Values | Retro::Ranges::Views::JoinWith(", "sv) | Retro::Ranges::To<std::string>();
+        benchmark::DoNotOptimize(Result);
+    }
+    SetItemsProcessed(State);
+}
+
+// Filtering the outer range means the joined view is not sized, so To can only reserve through the size hint
+static void JoinWithFilteredToStringRetro(benchmark::State &State) {
+    using namespace std::literals;
+    auto Values = MakeValues<std::string>(State.range(0));
+    auto IsNotEmpty = [](const std::string &Value) { return !Value.empty(); };
+    for (auto _ : State) {
+        auto Result = Values | Retro::Ranges::Views::Filter(IsNotEmpty) | Retro::Ranges::Views::JoinWith(", "sv) |
+                      Retro::Ranges::To<std::string>();
+        benchmark::DoNotOptimize(Result);
+    }
+    SetItemsProcessed(State);
+}
+
+BENCHMARK_TEMPLATE(JoinWithFlat, int)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(JoinWithHandWritten, int)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(JoinWithStdJoin, int)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(JoinWithRetro, int)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(JoinWithRetroSharedIterator, int)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(JoinWithFlat, double)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(JoinWithHandWritten, double)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(JoinWithStdJoin, double)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(JoinWithRetro, double)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(JoinWithRetroSharedIterator, double)->Apply(RangeSizes);
+
+BENCHMARK(JoinWithToStringHandWritten)->Apply(RangeSizes);
+BENCHMARK(JoinWithToStringExactHandWritten)->Apply(RangeSizes);
+BENCHMARK(JoinWithToStringRetro)->Apply(RangeSizes);
+BENCHMARK(JoinWithFilteredToStringRetro)->Apply(RangeSizes);
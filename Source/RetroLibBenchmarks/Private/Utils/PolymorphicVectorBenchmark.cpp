@@ -0,0 +1,132 @@
+/**
+ * @file PolymorphicVectorBenchmark.cpp
+ * @brief Benchmarks for updating a mix of polymorphic components stored in a TPolymorphicVector compared to a vector
+ * of TPolymorphic values.
+ *
+ * @author Retro & Chill
+ * https://github.com/retroandchill
+ */
+#include "BenchmarkUtils.h"
+
+#if RETROLIB_WITH_MODULES
+import std;
+import RetroLib;
+#else
+#include "RetroLib.h"
+
+#include <vector>
+#endif
+
+using namespace Retro::Benchmarks;
+
+namespace {
+    class FComponent {
+      public:
+        virtual ~FComponent() = default;
+
+        virtual void Update(float DeltaTime) = 0;
+    };
+
+    class FMover final : public FComponent {
+      public:
+        explicit FMover(std::int64_t Index) : Velocity(static_cast<float>(Index % 7)) {
+        }
+
+        void Update(float DeltaTime) override {
+            Position += Velocity * DeltaTime;
+        }
+
+      private:
+        float Position = 0;
+        float Velocity;
+    };
+
+    class FTimer final : public FComponent {
+      public:
+        explicit FTimer(std::int64_t) {
+        }
+
+        void Update(float DeltaTime) override {
+            Elapsed += DeltaTime;
+            Ticks++;
+        }
+
+      private:
+        float Elapsed = 0;
+        int Ticks = 0;
+    };
+
+    class FSpinner final : public FComponent {
+      public:
+        explicit FSpinner(std::int64_t Index) : Speed(static_cast<float>(Index % 3)) {
+        }
+
+        void Update(float DeltaTime) override {
+            Angle += Speed * DeltaTime;
+        }
+
+      private:
+        float Angle = 0;
+        float Speed;
+    };
+
+    template <typename C>
+    void AddComponents(std::int64_t Count, C &&Add) {
+        for (std::int64_t i = 0; i < Count; i++) {
+            switch (i % 3) {
+            case 0:
+                Add.template operator()<FMover>(i);
+                break;
+            case 1:
+                Add.template operator()<FTimer>(i);
+                break;
+            default:
+                Add.template operator()<FSpinner>(i);
+                break;
+            }
+        }
+    }
+} // namespace
+
+static void UpdatePolymorphicStdVector(benchmark::State &State) {
+    std::vector<Retro::TPolymorphic<FComponent>> Components;
+    AddComponents(State.range(0), [&Components]<typename U>(std::int64_t i) {
+        Components.emplace_back(std::in_place_type<U>, i);
+    });
+
+    for (auto _ : State) {
+        for (auto &Component : Components) {
+            Component->Update(0.5f);
+        }
+        benchmark::ClobberMemory();
+    }
+    SetItemsProcessed(State);
+}
+
+static void UpdatePolymorphicVector(benchmark::State &State) {
+    Retro::TPolymorphicVector<FComponent> Components;
+    AddComponents(State.range(0), [&Components]<typename U>(std::int64_t i) { Components.Emplace<U>(i); });
+
+    for (auto _ : State) {
+        for (auto &Component : Components) {
+            Component.Update(0.5f);
+        }
+        benchmark::ClobberMemory();
+    }
+    SetItemsProcessed(State);
+}
+
+static void UpdatePolymorphicVectorForEach(benchmark::State &State) {
+    Retro::TPolymorphicVector<FComponent> Components;
+    AddComponents(State.range(0), [&Components]<typename U>(std::int64_t i) { Components.Emplace<U>(i); });
+
+    for (auto _ : State) {
+        Components.ForEach<FMover, FTimer, FSpinner>([](auto &Component) { Component.Update(0.5f); });
+        benchmark::ClobberMemory();
+    }
+    SetItemsProcessed(State);
+}
+
+BENCHMARK(UpdatePolymorphicStdVector)->Apply(RangeSizes);
+BENCHMARK(UpdatePolymorphicVector)->Apply(RangeSizes);
+BENCHMARK(UpdatePolymorphicVectorForEach)->Apply(RangeSizes);
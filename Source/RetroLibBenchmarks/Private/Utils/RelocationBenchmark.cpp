@@ -0,0 +1,105 @@
+/**
+ * @file RelocationBenchmark.cpp
+ * @brief Benchmarks for relocating FUniqueAny and TPolymorphic values when a vector grows.
+ *
+ * @author Retro & Chill
+ * https://github.com/retroandchill
+ */
+#include "BenchmarkUtils.h"
+
+#if RETROLIB_WITH_MODULES
+import std;
+import RetroLib;
+#else
+#include "RetroLib.h"
+
+#include <array>
+#include <string>
+#include <vector>
+#endif
+
+using namespace Retro::Benchmarks;
+
+namespace {
+    class FShape {
+      public:
+        virtual ~FShape() = default;
+
+        virtual std::int64_t GetArea() const = 0;
+    };
+
+    class FSquare final : public FShape {
+      public:
+        explicit FSquare(std::int64_t Side) : Side(Side) {
+        }
+
+        std::int64_t GetArea() const override {
+            return Side * Side;
+        }
+
+      private:
+        std::int64_t Side;
+    };
+
+    class FPolygon final : public FShape {
+      public:
+        explicit FPolygon(std::int64_t Side) {
+            Sides.fill(Side);
+        }
+
+        std::int64_t GetArea() const override {
+            return Sides[0] * static_cast<std::int64_t>(Sides.size());
+        }
+
+      private:
+        std::array<std::int64_t, 16> Sides;
+    };
+} // namespace
+
+template <>
+struct Retro::TIsTriviallyRelocatable<FSquare> : std::true_type {};
+
+// Moves every element into a new buffer the same way std::vector does when it grows, so this only measures the cost
+// of relocating the stored values.
+template <typename T>
+static void RelocateAll(std::vector<T> &Values) {
+    std::vector<T> Relocated;
+    Relocated.reserve(Values.size());
+    for (auto &Value : Values) {
+        Relocated.push_back(std::move(Value));
+    }
+    Values = std::move(Relocated);
+}
+
+template <typename T>
+static void UniqueAnyRelocation(benchmark::State &State) {
+    std::vector<Retro::FUniqueAny> Values;
+    for (std::int64_t i = 0; i < State.range(0); i++) {
+        Values.emplace_back(MakeValue<T>(i));
+    }
+
+    for (auto _ : State) {
+        RelocateAll(Values);
+        benchmark::DoNotOptimize(Values.data());
+    }
+    SetItemsProcessed(State);
+}
+
+template <typename T>
+static void PolymorphicRelocation(benchmark::State &State) {
+    std::vector<Retro::TPolymorphic<FShape>> Values;
+    for (std::int64_t i = 0; i < State.range(0); i++) {
+        Values.emplace_back(std::in_place_type<T>, i);
+    }
+
+    for (auto _ : State) {
+        RelocateAll(Values);
+        benchmark::DoNotOptimize(Values.data());
+    }
+    SetItemsProcessed(State);
+}
+
+BENCHMARK_TEMPLATE(UniqueAnyRelocation, int)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(UniqueAnyRelocation, std::string)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(PolymorphicRelocation, FSquare)->Apply(RangeSizes);
+BENCHMARK_TEMPLATE(PolymorphicRelocation, FPolygon)->Apply(RangeSizes);
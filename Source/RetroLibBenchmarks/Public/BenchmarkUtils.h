@@ -0,0 +1,100 @@
+/**
+ * @file BenchmarkUtils.h
+ * @brief Shared input generation and sizing helpers for the range benchmarks.
+ *
+ * @author Retro & Chill
+ * https://github.com/retroandchill
+ */
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#if RETROLIB_WITH_MODULES
+import std;
+#else
+#include <concepts>
+#include <cstdint>
+#include <string>
+#include <vector>
+#endif
+
+namespace Retro::Benchmarks {
+    /**
+     * The smallest number of elements any range benchmark is run with.
+     */
+    constexpr std::int64_t MIN_RANGE_SIZE = 1 << 6;
+
+    /**
+     * The largest number of elements any range benchmark is run with.
+     */
+    constexpr std::int64_t MAX_RANGE_SIZE = 1 << 18;
+
+    /**
+     * Applies the standard set of range sizes to a benchmark. Used as the argument to `Benchmark::Apply` so that every
+     * adapter is measured over the same sizes and the results can be compared across files.
+     *
+     * @param Benchmark The benchmark to configure
+     */
+    inline void RangeSizes(benchmark::internal::Benchmark *Benchmark) {
+        Benchmark->RangeMultiplier(8)->Range(MIN_RANGE_SIZE, MAX_RANGE_SIZE);
+    }
+
+    /**
+     * Creates a deterministic value for the given index.
+     *
+     * @tparam T The type of value to create
+     * @param Index The index of the value in the generated sequence
+     * @return The generated value
+     */
+    template <typename T>
+    T MakeValue(std::int64_t Index) {
+        if constexpr (std::same_as<T, std::string>) {
+            return std::to_string(Index);
+        } else {
+            return static_cast<T>(Index);
+        }
+    }
+
+    /**
+     * Creates a vector of deterministic values to use as the input of a benchmark.
+     *
+     * @tparam T The element type
+     * @param Count The number of elements to generate
+     * @return The generated values
+     */
+    template <typename T>
+    std::vector<T> MakeValues(std::int64_t Count) {
+        std::vector<T> Result;
+        Result.reserve(static_cast<size_t>(Count));
+        for (std::int64_t i = 0; i < Count; i++) {
+            Result.push_back(MakeValue<T>(i));
+        }
+        return Result;
+    }
+
+    /**
+     * Reduces a value to an integer that can be folded into a checksum, so that every benchmark has an observable
+     * result regardless of element type.
+     *
+     * @tparam T The type of value
+     * @param Value The value to weigh
+     * @return The weight of the value
+     */
+    template <typename T>
+    constexpr std::int64_t Weigh(const T &Value) {
+        if constexpr (std::same_as<T, std::string>) {
+            return static_cast<std::int64_t>(Value.size());
+        } else {
+            return static_cast<std::int64_t>(Value);
+        }
+    }
+
+    /**
+     * Records the number of elements processed by the benchmark, using the first argument as the element count.
+     *
+     * @param State The state of the running benchmark
+     */
+    inline void SetItemsProcessed(benchmark::State &State) {
+        State.SetItemsProcessed(State.iterations() * State.range(0));
+    }
+} // namespace Retro::Benchmarks
@@ -14,10 +14,20 @@ import RetroLib;
 #include "RetroLib.h"
 
 #include <array>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <list>
 #include <optional>
 #include <vector>
 #include <map>
+#include <ranges>
+#include <numeric>
 #include <set>
+#include <span>
+#include <stdexcept>
+#include <string>
 #endif
 
 TEST_CASE_NAMED(FRangeToTest, "Retro::Ranges::Algorithm::To", "[ranges]") {
@@ -47,6 +57,193 @@ TEST_CASE_NAMED(FRangeToTest, "Retro::Ranges::Algorithm::To", "[ranges]") {
         auto AsMap = Pairs | Retro::Ranges::To<std::map<int, int>>();
         CHECK(AsMap == std::map<int, int>({{1, 2}, {3, 4}}));
     }
+
+    SECTION("Ordered associative containers are built from sorted input and keep the first duplicate") {
+        static_assert(Retro::Ranges::Detail::SortedBuildable<std::map<int, int>, std::vector<std::pair<int, int>> &>);
+        static_assert(Retro::Ranges::Detail::SortedBuildable<std::set<int>, std::vector<int> &>);
+        static_assert(!Retro::Ranges::Detail::SortedBuildable<std::vector<int>, std::vector<int> &>);
+
+        std::vector<std::pair<int, int>> Pairs = {{5, 0}, {1, 1}, {3, 2}, {1, 3}, {4, 4}, {5, 5}, {2, 6}};
+        auto AsMap = Pairs | Retro::Ranges::To<std::map<int, int>>();
+        CHECK(AsMap == std::map<int, int>({{1, 1}, {2, 6}, {3, 2}, {4, 4}, {5, 0}}));
+
+        auto AsMultimap = Pairs | Retro::Ranges::To<std::multimap<int, int>>();
+        CHECK(AsMultimap == std::multimap<int, int>(Pairs.begin(), Pairs.end()));
+
+        auto AsSet = Pairs | Retro::Ranges::Views::Keys | Retro::Ranges::To<std::set<int, std::greater<>>>();
+        CHECK(AsSet == std::set<int, std::greater<>>({5, 4, 3, 2, 1}));
+
+        std::map<int, int> Existing = {{3, 10}, {7, 11}};
+        Pairs | Retro::Ranges::AppendTo(Existing);
+        CHECK(Existing == std::map<int, int>({{1, 1}, {2, 6}, {3, 10}, {4, 4}, {5, 0}, {7, 11}}));
+    }
+
+    SECTION("Large inputs give the same result as inserting one element at a time") {
+        std::vector<std::pair<int, int>> Pairs;
+        for (int i = 0; i < static_cast<int>(Retro::Ranges::TO_SORTED_BUILD_MIN_SIZE) * 2; i++) {
+            Pairs.emplace_back((i * 7919) % 5000, i);
+        }
+
+        std::map<int, int> Expected;
+        std::multimap<int, int> ExpectedMulti;
+        for (auto &Pair : Pairs) {
+            Expected.emplace(Pair);
+            ExpectedMulti.emplace(Pair);
+        }
+        CHECK((Pairs | Retro::Ranges::To<std::map<int, int>>()) == Expected);
+        CHECK((Pairs | Retro::Ranges::To<std::multimap<int, int>>()) == ExpectedMulti);
+
+        auto Filtered = Pairs | Retro::Ranges::Views::Filter([](auto &Pair) { return Pair.second % 2 == 0; });
+        std::map<int, int> ExpectedFiltered;
+        for (auto &Pair : Filtered) {
+            ExpectedFiltered.emplace(Pair);
+        }
+        CHECK((Filtered | Retro::Ranges::To<std::map<int, int>>()) == ExpectedFiltered);
+
+        std::map<int, int> Existing = {{-1, 0}, {7, -7}};
+        Pairs | Retro::Ranges::AppendTo(Existing);
+        Expected.emplace(-1, 0);
+        CHECK(Existing.size() == Expected.size());
+        CHECK(Existing[7] == -7);
+
+        auto AsFlatMap = Pairs | Retro::Ranges::To<Retro::TFlatMap>();
+        auto AsMap = Pairs | Retro::Ranges::To<std::map<int, int>>();
+        std::vector<std::pair<int, int>> MapEntries(AsMap.begin(), AsMap.end());
+        CHECK(std::vector(AsFlatMap.begin(), AsFlatMap.end()) == MapEntries);
+    }
+
+    SECTION("Can build a flat map in a single sort") {
+        std::vector<std::pair<int, int>> Pairs = {{5, 0}, {1, 1}, {3, 2}, {1, 3}};
+        auto AsFlatMap = Pairs | Retro::Ranges::To<Retro::TFlatMap>();
+        static_assert(std::same_as<decltype(AsFlatMap), Retro::TFlatMap<int, int>>);
+        CHECK(std::ranges::equal(AsFlatMap, std::vector<std::pair<int, int>>({{1, 1}, {3, 2}, {5, 0}})));
+        CHECK(AsFlatMap.GetCapacity() == 4);
+    }
+
+    SECTION("Contiguous and sized common ranges are appended in bulk") {
+        static_assert(Retro::Ranges::RangeAppendableContainer<std::vector<float>, std::span<const float>>);
+        static_assert(Retro::Ranges::RangeAppendableContainer<std::vector<int>, std::list<int> &>);
+        static_assert(Retro::Ranges::RangeAppendableContainer<std::string, std::vector<char> &>);
+        static_assert(!Retro::Ranges::RangeAppendableContainer<std::set<int>, std::vector<int> &>);
+        static_assert(!Retro::Ranges::RangeAppendableContainer<
+                      std::vector<int>, decltype(std::views::iota(0) | std::views::take(5))>);
+
+        static constexpr std::array Floats = {1.0f, 2.0f, 3.0f, 4.0f};
+        auto FromSpan = std::span(Floats) | Retro::Ranges::To<std::vector>();
+        CHECK(FromSpan == std::vector({1.0f, 2.0f, 3.0f, 4.0f}));
+        CHECK(Retro::Ranges::ContainerCapacity(FromSpan) == 4);
+
+        std::list List = {1, 2, 3};
+        auto FromList = List | Retro::Ranges::To<std::vector>();
+        CHECK(FromList == std::vector({1, 2, 3}));
+        CHECK(Retro::Ranges::ContainerCapacity(FromList) == 3);
+
+        std::vector Chars = {'a', 'b', 'c'};
+        CHECK((Chars | Retro::Ranges::To<std::string>()) == "abc");
+    }
+}
+
+TEST_CASE_NAMED(FRangeAssignToTest, "Retro::Ranges::Algorithm::AssignTo", "[ranges]") {
+    std::vector<int> Buffer;
+    Buffer.reserve(16);
+    auto Data = Buffer.data();
+
+    SECTION("Can append to an existing container") {
+        std::array Values = {1, 2, 3};
+        auto &Result = Values | Retro::Ranges::AppendTo(Buffer);
+        CHECK(&Result == &Buffer);
+        Values | std::views::transform([](int Value) { return Value * 10; }) | Retro::Ranges::AppendTo(Buffer);
+        Retro::Ranges::AppendTo(std::views::iota(4, 6), Buffer);
+        CHECK(Buffer == std::vector({1, 2, 3, 10, 20, 30, 4, 5}));
+        CHECK(Buffer.data() == Data);
+    }
+
+    SECTION("Assigning replaces the contents while keeping the capacity") {
+        for (int i = 0; i < 4; i++) {
+            std::views::iota(0, 10 + i) | std::views::filter([](int Value) { return Value % 2 == 0; }) |
+                Retro::Ranges::AssignTo(Buffer);
+            CHECK(Buffer.size() == static_cast<size_t>(5 + (i + 1) / 2));
+            CHECK(Buffer.front() == 0);
+            CHECK(Buffer.data() == Data);
+            CHECK(Buffer.capacity() == 16);
+        }
+
+        std::set<int> Set = {7};
+        Retro::Ranges::AssignTo(std::array{1, 2, 2}, Set);
+        CHECK(Set == std::set({1, 2}));
+    }
+
+    SECTION("Can assign a range that reads from the container itself") {
+        Buffer = {1, 2, 3, 4, 5, 6};
+        Buffer | Retro::Ranges::Views::Filter([](int Value) { return Value % 2 == 0; }) |
+            Retro::Ranges::AssignTo(Buffer);
+        CHECK(Buffer == std::vector({2, 4, 6}));
+
+        Buffer | std::views::reverse | Retro::Ranges::AssignTo(Buffer);
+        CHECK(Buffer == std::vector({6, 4, 2}));
+
+        std::span(Buffer).subspan(1) | Retro::Ranges::AssignTo(Buffer);
+        CHECK(Buffer == std::vector({4, 2}));
+
+        Retro::Ranges::AssignTo(Buffer, Buffer);
+        CHECK(Buffer == std::vector({4, 2}));
+    }
+
+    SECTION("Appending grows the container geometrically") {
+        for (int i = 0; i < 32; i++) {
+            std::array{i} | Retro::Ranges::AppendTo(Buffer);
+        }
+        CHECK(Buffer.size() == 32);
+        CHECK(Buffer.capacity() == 32);
+    }
+}
+
+namespace {
+    constexpr auto SquareTable = std::views::iota(0, 8) | Retro::Ranges::Views::Transform([](int Value) {
+                                     return Value * Value;
+                                 }) |
+                                 Retro::Ranges::ToArray<8>();
+
+    constexpr auto EvenSquares =
+        Retro::Ranges::Views::Concat(std::array{1, 2, 3}, std::array{4, 5, 6}) |
+        Retro::Ranges::Views::Filter([](int Value) { return Value % 2 == 0; }) |
+        Retro::Ranges::Views::Transform([](int Value) { return Value * Value; }) | Retro::Ranges::ToStaticVector<8>();
+
+    constexpr auto IndexedTable = [] {
+        constexpr std::array Values = {10, 20, 30};
+        return Values | Retro::Ranges::Views::Enumerate | Retro::Ranges::Views::Transform([](auto Pair) {
+                   auto [Index, Value] = Pair;
+                   return static_cast<int>(Index) + Value;
+               }) |
+               Retro::Ranges::ToArray<3>();
+    }();
+} // namespace
+
+TEST_CASE_NAMED(FRangeToArrayTest, "Retro::Ranges::Algorithm::ToArray", "[ranges]") {
+    SECTION("Range pipelines can be evaluated at compile time") {
+        static_assert(SquareTable == std::array{0, 1, 4, 9, 16, 25, 36, 49});
+        static_assert(EvenSquares.size() == 3);
+        static_assert(EvenSquares[0] == 4 && EvenSquares[1] == 16 && EvenSquares[2] == 36);
+        static_assert(IndexedTable == std::array{10, 21, 32});
+        CHECK(SquareTable[7] == 49);
+        CHECK(std::ranges::equal(EvenSquares, std::array{4, 16, 36}));
+    }
+
+    SECTION("Ranges that do not fit are rejected at runtime") {
+        std::vector Values = {1, 2, 3, 4};
+        CHECK(Retro::Ranges::ToArray<4>(Values) == std::array{1, 2, 3, 4});
+        CHECK_THROWS_AS(Values | Retro::Ranges::ToArray<3>(), std::length_error);
+        CHECK_THROWS_AS(Values | Retro::Ranges::ToArray<5>(), std::length_error);
+        CHECK_THROWS_AS(Values | Retro::Ranges::Views::Filter([](int Value) { return Value > 0; }) |
+                            Retro::Ranges::ToStaticVector<3>(),
+                        std::length_error);
+        CHECK_THROWS_AS(Values | Retro::Ranges::ToStaticVector<3>(), std::length_error);
+        CHECK(Retro::Ranges::ToStaticVector<4>(Values).size() == 4);
+
+        auto Filtered = Values | Retro::Ranges::Views::Filter([](int Value) { return Value > 1; }) |
+                        Retro::Ranges::ToArray<3>();
+        CHECK(Filtered == std::array{2, 3, 4});
+    }
 }
 
 TEST_CASE_NAMED(FRangeForEachTest, "Retro::Ranges::Algorithm::ForEach", "[ranges]") {
@@ -81,6 +278,240 @@ TEST_CASE_NAMED(FRangeReduceTest, "Retro::Ranges::Algorithm::Reduce", "[ranges]"
         auto Result = Values | Retro::Ranges::Reduce<Retro::Add>(0);
         CHECK(Result == 15);
     }
+
+    SECTION("Can reduce a large range in parallel") {
+        std::vector<int> Large(10000);
+        std::iota(Large.begin(), Large.end(), 1);
+        constexpr Retro::Ranges::FParallelPolicy Policy = {.MaxThreads = 4, .MinChunkSize = 16};
+        CHECK(Retro::Ranges::Reduce(Policy, Large, 0, Retro::Add) == 50005000);
+        CHECK(Retro::Ranges::Reduce<Retro::Add>(Policy, Large, 0) == 50005000);
+        CHECK((Large | Retro::Ranges::Reduce(Policy, 0, Retro::Add)) == 50005000);
+        CHECK((Large | Retro::Ranges::Reduce<Retro::Add>(Policy, 0)) == 50005000);
+
+        // The identity is only applied once, even when the range is split
+        CHECK(Retro::Ranges::Reduce(Policy, Large, 100, Retro::Add) == 50005100);
+    }
+
+    SECTION("Parallel reduction keeps the order of non-commutative functors") {
+        std::vector<std::string> Letters;
+        for (char c = 'a'; c <= 'z'; c++) {
+            Letters.emplace_back(1, c);
+        }
+        constexpr Retro::Ranges::FParallelPolicy Policy = {.MaxThreads = 4, .MinChunkSize = 2};
+        auto Result = Retro::Ranges::Reduce(Policy, Letters, std::string(), Retro::Add);
+        CHECK(Result == "abcdefghijklmnopqrstuvwxyz");
+    }
+
+    SECTION("Parallel reduction falls back to sequential for other ranges") {
+        auto Result = Values | Retro::Ranges::Views::Filter([](int i) { return i % 2 == 1; }) |
+                      Retro::Ranges::Reduce(Retro::Ranges::Par, 0, Retro::Add);
+        CHECK(Result == 9);
+        CHECK((Values | Retro::Ranges::Reduce(Retro::Ranges::Seq, 0, Retro::Add)) == 15);
+    }
+
+    SECTION("Vectorized reductions match a serial fold") {
+        static_assert(Retro::Ranges::Reduce(Values, 0, Retro::Add) == 15);
+        static_assert(Retro::Ranges::Reduce(Values, 1, Retro::Multiply) == 120);
+
+        for (int Size : {0, 3, 17, 64, 255, 1000}) {
+            std::vector<std::int32_t> Integers(Size);
+            std::vector<std::uint64_t> Unsigned(Size);
+            std::vector<double> Doubles(Size);
+            for (int i = 0; i < Size; i++) {
+                Integers[i] = (i * 7919) % 1000 - 500;
+                Unsigned[i] = static_cast<std::uint64_t>(i) * 0x9E3779B97F4A7C15ull;
+                Doubles[i] = static_cast<double>(Integers[i]);
+            }
+
+            // Integer results are exact, and so are sums of small whole numbers stored as doubles
+            CHECK(Retro::Ranges::Reduce(Integers, 3, Retro::Add) ==
+                  std::accumulate(Integers.begin(), Integers.end(), 3));
+            CHECK(Retro::Ranges::Reduce(Integers, 1, Retro::Multiply) ==
+                  static_cast<std::int32_t>(
+                      std::accumulate(Integers.begin(), Integers.end(), 1u, std::multiplies<std::uint32_t>())));
+            CHECK(Retro::Ranges::Reduce(Integers, 0, Retro::Min) ==
+                  std::min(0, Size > 0 ? std::ranges::min(Integers) : 0));
+            CHECK((Integers | Retro::Ranges::Reduce<Retro::Max>(0)) ==
+                  std::max(0, Size > 0 ? std::ranges::max(Integers) : 0));
+            CHECK(Retro::Ranges::Reduce(Unsigned, std::uint64_t{1}, Retro::Add) ==
+                  std::accumulate(Unsigned.begin(), Unsigned.end(), std::uint64_t{1}));
+            CHECK(Retro::Ranges::Reduce(Unsigned, std::uint64_t{0}, Retro::Max) ==
+                  (Size > 0 ? std::ranges::max(Unsigned) : 0));
+            CHECK(Retro::Ranges::Reduce(Doubles, 0.5, Retro::Add) ==
+                  std::accumulate(Doubles.begin(), Doubles.end(), 0.5));
+            CHECK(Retro::Ranges::Reduce(Doubles, 1000.0, Retro::Min) ==
+                  std::min(1000.0, Size > 0 ? std::ranges::min(Doubles) : 1000.0));
+        }
+    }
+
+    SECTION("NaN values in the first block are skipped the same way as in a serial fold") {
+        constexpr float NaN = std::numeric_limits<float>::quiet_NaN();
+        for (int Size : {6, 64, 1000}) {
+            std::vector<float> Floats(Size, 5.0f);
+            Floats[0] = NaN;
+            Floats[Size / 3] = -3.0f;
+            Floats[Size - 1] = 8.0f;
+            CHECK(Retro::Ranges::Reduce(Floats, 1000.0f, Retro::Min) == -3.0f);
+            CHECK(Retro::Ranges::Reduce(Floats, -1000.0f, Retro::Max) == 8.0f);
+            CHECK(std::isnan(Retro::Ranges::Reduce(Floats, NaN, Retro::Min)));
+
+            std::vector<double> Doubles(Floats.begin(), Floats.end());
+            CHECK(Retro::Ranges::Reduce(Doubles, 1000.0, Retro::Min) == -3.0);
+            CHECK(Retro::Ranges::Reduce(Doubles, -1000.0, Retro::Max) == 8.0);
+
+            constexpr auto Negate = [](float Value) { return -Value; };
+            CHECK(Retro::Ranges::TransformReduce(Floats, -1000.0f, Retro::Max, Negate) == 3.0f);
+        }
+    }
+
+    SECTION("The sequenced policy reduces floating point values strictly in order") {
+        std::vector<float> Floats(1000);
+        for (int i = 0; i < 1000; i++) {
+            Floats[i] = 1.0f / static_cast<float>(i + 1);
+        }
+
+        float Expected = 0.0f;
+        for (float Value : Floats) {
+            Expected += Value;
+        }
+        CHECK(Retro::Ranges::Reduce(Retro::Ranges::Seq, Floats, 0.0f, Retro::Add) == Expected);
+        CHECK((Floats | Retro::Ranges::Reduce<Retro::Add>(Retro::Ranges::Seq, 0.0f)) == Expected);
+        CHECK(std::abs(Retro::Ranges::Reduce(Floats, 0.0f, Retro::Add) - Expected) < 1e-4f);
+    }
+
+    SECTION("Exceptions thrown by a worker are propagated to the caller") {
+        std::vector<int> Large(1000, 1);
+        Large[900] = -1;
+        constexpr Retro::Ranges::FParallelPolicy Policy = {.MaxThreads = 4, .MinChunkSize = 16};
+        auto Checked = [](int Sum, int Value) {
+            if (Value < 0) {
+                throw std::invalid_argument("Negative value");
+            }
+            return Sum + Value;
+        };
+        CHECK_THROWS_AS(Retro::Ranges::Reduce(Policy, Large, 0, Checked), std::invalid_argument);
+    }
+}
+
+TEST_CASE_NAMED(FRangeReduceManyTest, "Retro::Ranges::Algorithm::ReduceMany", "[ranges]") {
+    static constexpr std::array Values = {4, 2, 5, 1, 3};
+    static constexpr auto Count = [](int Total, int) { return Total + 1; };
+
+    SECTION("Can compute several aggregates in one pass") {
+        static_assert(std::get<1>(Retro::Ranges::ReduceMany(Values, Retro::Ranges::Reducer(0, Count),
+                                                            Retro::Ranges::Reducer<Retro::Add>(0))) == 15);
+
+        auto [Size, Sum, Lowest, Highest] =
+            Values | Retro::Ranges::ReduceMany(Retro::Ranges::Reducer(0, Count), Retro::Ranges::Reducer(0, Retro::Add),
+                                               Retro::Ranges::Reducer<Retro::Min>(std::numeric_limits<int>::max()),
+                                               Retro::Ranges::Reducer<Retro::Max>(std::numeric_limits<int>::min()));
+        CHECK(Size == 5);
+        CHECK(Sum == 15);
+        CHECK(Lowest == 1);
+        CHECK(Highest == 5);
+    }
+
+    SECTION("Traverses a single-pass range only once") {
+        int Visited = 0;
+        auto Source = Values | Retro::Ranges::Views::Transform([&Visited](int Value) {
+                          Visited++;
+                          return Value;
+                      });
+        auto [Sum, Product] = Retro::Ranges::ReduceMany(Source, Retro::Ranges::Reducer(0, Retro::Add),
+                                                        Retro::Ranges::Reducer(1, Retro::Multiply));
+        CHECK(Sum == 15);
+        CHECK(Product == 120);
+        CHECK(Visited == 5);
+    }
+
+    SECTION("Stops once every reducer is saturated") {
+        int Visited = 0;
+        auto Source = Values | Retro::Ranges::Views::Transform([&Visited](int Value) {
+                          Visited++;
+                          return Value;
+                      });
+        auto HasLargeValue = Retro::Ranges::Reducer(
+            false, [](bool Found, int Value) { return Found || Value >= 5; }, [](bool Found) { return Found; });
+        auto HasSmallValue = Retro::Ranges::Reducer(
+            false, [](bool Found, int Value) { return Found || Value <= 2; }, [](bool Found) { return Found; });
+
+        auto [Large, Small] = Retro::Ranges::ReduceMany(Source, HasLargeValue, HasSmallValue);
+        CHECK(Large);
+        CHECK(Small);
+        CHECK(Visited == 3);
+
+        // A reducer that can't saturate keeps the traversal going, while the saturated ones are no longer applied
+        Visited = 0;
+        auto [StillLarge, Sum] =
+            Source | Retro::Ranges::ReduceMany(HasLargeValue, Retro::Ranges::Reducer(0, Retro::Add));
+        CHECK(StillLarge);
+        CHECK(Sum == 15);
+        CHECK(Visited == 5);
+    }
+
+    SECTION("Reducers that are saturated at their identity are never applied") {
+        int Calls = 0;
+        auto HasLargeValue = Retro::Ranges::Reducer(
+            false, [](bool Found, int Value) { return Found || Value >= 5; }, [](bool Found) { return Found; });
+        auto Capped = Retro::Ranges::Reducer(
+            10,
+            [&Calls](int Total, int Value) {
+                Calls++;
+                return Total + Value;
+            },
+            [](int Total) { return Total >= 10; });
+
+        auto [Large, CappedTotal] = Retro::Ranges::ReduceMany(Values, HasLargeValue, Capped);
+        CHECK(Large);
+        CHECK(CappedTotal == 10);
+        CHECK(Calls == 0);
+
+        auto [StillLarge, StillCapped, Sum] =
+            Values | Retro::Ranges::ReduceMany(HasLargeValue, Capped, Retro::Ranges::Reducer(0, Retro::Add));
+        CHECK(StillLarge);
+        CHECK(StillCapped == 10);
+        CHECK(Sum == 15);
+        CHECK(Calls == 0);
+    }
+}
+
+TEST_CASE_NAMED(FRangeTransformReduceTest, "Retro::Ranges::Algorithm::TransformReduce", "[ranges]") {
+    static constexpr std::array Values = {1, 2, 3, 4, 5};
+    static constexpr auto Square = [](int Value) { return Value * Value; };
+    constexpr auto Multiply = [](int Value, int Factor) { return Value * Factor; };
+
+    SECTION("Can transform and reduce a range using runtime functors") {
+        static_assert(Retro::Ranges::TransformReduce(Values, 0, Retro::Add, Square) == 55);
+        CHECK(Retro::Ranges::TransformReduce(Values, 0, Retro::Add, Multiply, 2) == 30);
+        CHECK((Values | Retro::Ranges::TransformReduce(0, Retro::Add, Square)) == 55);
+        CHECK((Values | Retro::Ranges::TransformReduce(0, Retro::Add, Multiply, 3)) == 45);
+    }
+
+    SECTION("Can transform and reduce a range using constexpr functors") {
+        static_assert(Retro::Ranges::TransformReduce<Retro::Add, Square>(Values, 0) == 55);
+        CHECK(Retro::Ranges::TransformReduce<Retro::Add, Multiply>(Values, 0, 2) == 30);
+        CHECK((Values | Retro::Ranges::TransformReduce<Retro::Add, Square>(0)) == 55);
+        CHECK((Values | Retro::Ranges::TransformReduce<Retro::Max, Multiply>(0, -1)) == 0);
+    }
+
+    SECTION("Matches piping a transform into a reduction") {
+        for (int Size : {0, 7, 255, 256, 257, 1000}) {
+            std::vector<float> Floats(Size);
+            for (int i = 0; i < Size; i++) {
+                Floats[i] = static_cast<float>(i % 17);
+            }
+            constexpr auto Double = [](float Value) { return Value * 2.0f; };
+            auto Expected = Floats | Retro::Ranges::Views::Transform(Double) | Retro::Ranges::Reduce(1.0f, Retro::Add);
+            CHECK(Retro::Ranges::TransformReduce(Floats, 1.0f, Retro::Add, Double) == Expected);
+        }
+    }
+
+    SECTION("Works with ranges that are not contiguous") {
+        std::vector<std::string> Names = {"one", "two", "three"};
+        auto Result = Names | Retro::Ranges::Views::Filter([](const std::string &Name) { return Name.size() == 3; }) |
+                      Retro::Ranges::TransformReduce(std::size_t{0}, Retro::Add, &std::string::size);
+        CHECK(Result == 6);
+    }
 }
 
 TEST_CASE_NAMED(FRangeFindFirstTest, "Retro::Ranges::Algorithm::FindFirst", "[ranges]") {
@@ -13,9 +13,42 @@ import RetroLib;
 #else
 #include "RetroLib.h"
 
+#include <array>
+#include <list>
+#include <memory>
+#include <type_traits>
 #include <vector>
 #endif
 
+namespace {
+    int AllocationCount = 0;
+
+    template <typename T>
+    struct TCountingAllocator {
+        using value_type = T;
+
+        TCountingAllocator() = default;
+
+        template <typename U>
+        explicit(false) TCountingAllocator(const TCountingAllocator<U> &) {
+        }
+
+        T *allocate(size_t Count) {
+            AllocationCount++;
+            return std::allocator<T>().allocate(Count);
+        }
+
+        void deallocate(T *Ptr, size_t Count) {
+            std::allocator<T>().deallocate(Ptr, Count);
+        }
+
+        template <typename U>
+        bool operator==(const TCountingAllocator<U> &) const {
+            return true;
+        }
+    };
+} // namespace
+
 TEST_CASE_NAMED(FAnyViewTest, "RetroLib::Ranges::Views::AnyView", "[views]") {
     SECTION("Iterating over a default initialized view is empty") {
         Retro::Ranges::TAnyView<int> View;
@@ -71,4 +104,148 @@ TEST_CASE_NAMED(FAnyViewTest, "RetroLib::Ranges::Views::AnyView", "[views]") {
         }
         CHECK(Count == 6);
     }
-}
\ No newline at end of file
+
+    SECTION("Contiguous ranges expose their elements as a span") {
+        std::vector<int> Values = {1, 2, 3, 4};
+        Retro::Ranges::TAnyView<int> View = std::ranges::views::all(Values);
+        auto Span = View.TryGetSpan();
+        REQUIRE(Span.has_value());
+        CHECK(Span->data() == Values.data());
+        CHECK(Span->size() == 4);
+
+        int Count = 0;
+        for (auto Value : View) {
+            Count += Value;
+        }
+        CHECK(Count == 10);
+    }
+
+    SECTION("Non-contiguous ranges can be iterated, but do not expose a span") {
+        std::list<int> Values = {1, 2, 3, 4};
+        Retro::Ranges::TAnyView<int> SizedView = std::ranges::views::all(Values);
+        CHECK_FALSE(SizedView.TryGetSpan().has_value());
+
+        int Count = 0;
+        for (auto Value : SizedView) {
+            Count += Value;
+        }
+        CHECK(Count == 10);
+
+        Retro::Ranges::TAnyView<int> UnsizedView =
+            Values | std::ranges::views::filter([](int Value) { return Value % 2 == 0; });
+        CHECK_FALSE(UnsizedView.TryGetSpan().has_value());
+        Count = 0;
+        for (auto Value : UnsizedView) {
+            Count += Value;
+        }
+        CHECK(Count == 6);
+    }
+
+    SECTION("Can read elements in batches") {
+        std::vector<int> Values = {1, 2, 3, 4, 5};
+        std::list<int> List = {1, 2, 3, 4, 5};
+        auto Filter = std::ranges::views::filter([](int) { return true; });
+        std::array<Retro::Ranges::TAnyView<int>, 3> Views = {std::ranges::views::all(Values), std::ranges::views::all(List),
+                                                             List | Filter};
+        for (auto &View : Views) {
+            std::array<int, 2> Buffer;
+            auto Iterator = View.begin();
+            CHECK(View.ReadBatch(Iterator, Buffer) == 2);
+            CHECK(Buffer == std::array{1, 2});
+            CHECK(View.ReadBatch(Iterator, Buffer) == 2);
+            CHECK(Buffer == std::array{3, 4});
+            CHECK(View.ReadBatch(Iterator, Buffer) == 1);
+            CHECK(Buffer[0] == 5);
+            CHECK(Iterator == View.end());
+            CHECK(View.ReadBatch(Iterator, Buffer) == 0);
+        }
+    }
+
+    SECTION("A moved-from view still holds a valid range") {
+        static_assert(std::is_nothrow_move_constructible_v<Retro::Ranges::TAnyView<int>>);
+        static_assert(std::is_nothrow_move_assignable_v<Retro::Ranges::TAnyView<int>>);
+        static_assert(std::is_nothrow_move_constructible_v<std::ranges::iterator_t<Retro::Ranges::TAnyView<int>>>);
+        static_assert(std::is_nothrow_move_assignable_v<std::ranges::iterator_t<Retro::Ranges::TAnyView<int>>>);
+
+        std::array Values = {1, 2, 3, 4, 5, 6};
+        auto Filter = std::ranges::views::filter([](int Value) { return Value % 2 == 0; });
+        auto Transform = std::ranges::views::transform([](int Value) { return Value * 2; });
+        auto Pipeline = Values | Filter | Transform | Filter | Transform;
+        static_assert(!Retro::Ranges::TAnyView<int>::FitsSmallStorage<decltype(Pipeline)>);
+
+        Retro::Ranges::TAnyView<int> Original = Pipeline;
+        auto Iterator = Original.begin();
+        auto MovedIterator = std::move(Iterator);
+        CHECK(*MovedIterator == 8);
+        Iterator = Original.begin();
+        CHECK(*Iterator == 8);
+
+        Retro::Ranges::TAnyView<int> Moved = std::move(Original);
+        CHECK((Original | Retro::Ranges::To<std::vector>()) == std::vector{8, 16, 24});
+        CHECK((Moved | Retro::Ranges::To<std::vector>()) == std::vector{8, 16, 24});
+
+        Retro::Ranges::TAnyView<int> Assigned = Values | Filter;
+        Assigned = std::move(Moved);
+        CHECK((Assigned | Retro::Ranges::To<std::vector>()) == std::vector{8, 16, 24});
+
+        Moved = std::vector{1, 2};
+        CHECK((Moved | Retro::Ranges::To<std::vector>()) == std::vector{1, 2});
+    }
+
+    SECTION("Elements that can't be assigned can be iterated, but not read in batches") {
+        struct FConstValue {
+            const int Value;
+        };
+        static_assert(!Retro::Ranges::BatchReadableRange<Retro::Ranges::TAnyView<FConstValue>>);
+        static_assert(Retro::Ranges::BatchReadableRange<Retro::Ranges::TAnyView<int>>);
+
+        std::list<FConstValue> Values = {{1}, {2}, {3}};
+        Retro::Ranges::TAnyView<FConstValue> View = std::ranges::views::all(Values);
+        int Sum = 0;
+        for (auto Element : View) {
+            Sum += Element.Value;
+        }
+        CHECK(Sum == 6);
+    }
+
+    SECTION("Can collect an erased view into a container") {
+        Retro::Ranges::TAnyView<int> View =
+            std::ranges::views::iota(0, 200) | std::ranges::views::filter([](int Value) { return Value % 2 == 0; });
+        auto Result = View | Retro::Ranges::To<std::vector>();
+        REQUIRE(Result.size() == 100);
+        CHECK(Result.front() == 0);
+        CHECK(Result.back() == 198);
+    }
+
+    SECTION("Can configure the inline storage size and allocator") {
+        std::array Values = {1, 2, 3, 4, 5, 6};
+        auto Filter = std::ranges::views::filter([](int Value) { return Value % 2 == 0; });
+        auto Transform = std::ranges::views::transform([](int Value) { return Value * 2; });
+        auto Pipeline = Values | Filter | Transform | Filter | Transform;
+
+        using FSmallView =
+            Retro::Ranges::TAnyView<int, Retro::DEFAULT_SMALL_STORAGE_SIZE, TCountingAllocator<std::byte>>;
+        using FLargeView = Retro::Ranges::TAnyView<int, 256, TCountingAllocator<std::byte>>;
+        static_assert(FSmallView::FitsSmallStorage<std::ranges::ref_view<std::vector<int>>>);
+        static_assert(!FSmallView::FitsSmallStorage<decltype(Pipeline)>);
+        static_assert(FLargeView::FitsSmallStorage<decltype(Pipeline)>);
+
+        AllocationCount = 0;
+        FSmallView SmallView = Pipeline;
+        int Count = 0;
+        for (auto Value : SmallView) {
+            Count += Value;
+        }
+        CHECK(Count == 48);
+        CHECK(AllocationCount > 0);
+
+        AllocationCount = 0;
+        FLargeView LargeView = Pipeline;
+        Count = 0;
+        for (auto Value : LargeView) {
+            Count += Value;
+        }
+        CHECK(Count == 48);
+        CHECK(AllocationCount == 0);
+    }
+}
@@ -0,0 +1,159 @@
+/**
+ * @file ChunkTest.cpp
+ * @brief Test file for the Chunk view.
+ *
+ * @author Retro & Chill
+ * https://github.com/retroandchill
+ */
+#include "TestAdapter.h"
+
+#if RETROLIB_WITH_MODULES
+import std;
+import RetroLib;
+#else
+#include "RetroLib.h"
+
+#include <array>
+#include <list>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+#endif
+
+namespace {
+#if RETROLIB_WITH_COROUTINES
+    Retro::TGenerator<int> CountTo(int Last) {
+        for (int i = 1; i <= Last; i++) {
+            co_yield i;
+        }
+    }
+#endif
+
+    constexpr int SumOfChunkSizes() {
+        std::array Values = {1, 2, 3, 4, 5, 6, 7};
+        int Sum = 0;
+        for (auto Chunk : Values | Retro::Ranges::Views::Chunk(3)) {
+            Sum += static_cast<int>(Chunk.size()) * Chunk.front();
+        }
+        return Sum;
+    }
+} // namespace
+
+TEST_CASE_NAMED(FChunkViewTest, "RetroLib::Ranges::Views::Chunk", "[views]") {
+    static_assert(SumOfChunkSizes() == 3 * 1 + 3 * 4 + 1 * 7);
+
+    SECTION("Contiguous ranges are split into spans over the original elements") {
+        std::vector Values = {1, 2, 3, 4, 5, 6, 7, 8};
+        auto Chunks = Values | Retro::Ranges::Views::Chunk(3);
+        using FChunksType = decltype(Chunks);
+        static_assert(std::ranges::random_access_range<FChunksType>);
+        static_assert(std::ranges::sized_range<FChunksType>);
+        static_assert(std::same_as<std::ranges::range_reference_t<FChunksType>, std::span<int>>);
+
+        REQUIRE(Chunks.size() == 3);
+        CHECK(Chunks[0].data() == Values.data());
+        CHECK(Chunks[1].data() == Values.data() + 3);
+        CHECK(Chunks[2].size() == 2);
+        CHECK(Chunks[2].back() == 8);
+        CHECK(std::ranges::distance(Chunks) == 3);
+        CHECK((*(Chunks.end() - 1)).size() == 2);
+
+        for (auto Chunk : Chunks) {
+            for (auto &Value : Chunk) {
+                Value *= 2;
+            }
+        }
+        CHECK(Values == std::vector{2, 4, 6, 8, 10, 12, 14, 16});
+
+        const auto &ConstValues = Values;
+        auto ConstChunks = ConstValues | Retro::Ranges::Views::Chunk(4);
+        static_assert(std::same_as<std::ranges::range_reference_t<decltype(ConstChunks)>, std::span<const int>>);
+        CHECK(std::as_const(ConstChunks).size() == 2);
+        CHECK(std::as_const(ConstChunks)[1].front() == 10);
+    }
+
+    SECTION("Contiguous ranges that divide evenly or are empty have no partial chunk") {
+        std::vector Values = {1, 2, 3, 4};
+        auto Chunks = Values | Retro::Ranges::Views::Chunk(2);
+        REQUIRE(Chunks.size() == 2);
+        CHECK(Chunks[1].size() == 2);
+
+        std::vector<int> Empty;
+        auto EmptyChunks = Empty | Retro::Ranges::Views::Chunk(2);
+        CHECK(EmptyChunks.size() == 0);
+        CHECK(EmptyChunks.begin() == EmptyChunks.end());
+    }
+
+    SECTION("Elements that can't be copied can still be sliced") {
+        std::vector<std::unique_ptr<int>> Values;
+        for (int i = 0; i < 5; i++) {
+            Values.push_back(std::make_unique<int>(i));
+        }
+
+        int Sum = 0;
+        for (auto Chunk : Values | Retro::Ranges::Views::Chunk(2)) {
+            Sum += *Chunk.back();
+        }
+        CHECK(Sum == 1 + 3 + 4);
+    }
+
+    SECTION("Ranges that are not contiguous are copied into a reused buffer") {
+        std::list<std::string> Values = {"A", "B", "C", "D", "E"};
+        auto Chunks = Values | Retro::Ranges::Views::Chunk(2);
+        static_assert(std::same_as<std::ranges::range_reference_t<decltype(Chunks)>, std::span<std::string>>);
+        CHECK(Chunks.size() == 3);
+
+        std::vector<std::string> Joined;
+        const std::string *Buffer = nullptr;
+        for (auto Chunk : Chunks) {
+            if (Buffer == nullptr) {
+                Buffer = Chunk.data();
+            }
+            CHECK(Chunk.data() == Buffer);
+            Joined.emplace_back(Chunk.front() + Chunk.back());
+        }
+        CHECK(Joined == std::vector<std::string>{"AB", "CD", "EE"});
+    }
+
+    SECTION("Single pass ranges can be split into chunks") {
+#if RETROLIB_WITH_COROUTINES
+        std::vector<std::vector<int>> Batches;
+        for (auto Chunk : CountTo(7) | Retro::Ranges::Views::Chunk(3)) {
+            Batches.emplace_back(Chunk.begin(), Chunk.end());
+        }
+        CHECK(Batches == std::vector<std::vector<int>>{{1, 2, 3}, {4, 5, 6}, {7}});
+
+        auto EmptyChunks = CountTo(0) | Retro::Ranges::Views::Chunk(3);
+        CHECK(EmptyChunks.begin() == EmptyChunks.end());
+#endif
+
+        Retro::Ranges::TAnyView<int> AnyView = std::vector{1, 2, 3, 4};
+        auto AnyChunks = Retro::Ranges::Views::Chunk(AnyView, 4);
+        int Count = 0;
+        for (auto Chunk : AnyChunks) {
+            CHECK(Chunk.size() == 4);
+            Count++;
+        }
+        CHECK(Count == 1);
+
+        Retro::Ranges::TAnyView<int> Batched = std::list{1, 2, 3, 4, 5};
+        std::vector<size_t> BatchSizes;
+        for (auto Chunk : Batched | Retro::Ranges::Views::Batch(2)) {
+            BatchSizes.push_back(Chunk.size());
+        }
+        CHECK(BatchSizes == std::vector<size_t>{2, 2, 1});
+    }
+
+    SECTION("The number of chunks is known up front when the number of elements is") {
+        auto Chunks = std::list{1, 2, 3, 4, 5} | Retro::Ranges::Views::Chunk(2);
+        auto Hint = Retro::Ranges::SizeHint(Chunks);
+        CHECK(Hint.LowerBound == 3);
+        CHECK(Hint.UpperBound == 3);
+
+        auto Sizes = Retro::Ranges::Views::Iota(0, 10) | Retro::Ranges::Views::Chunk(4) |
+                     Retro::Ranges::Views::Transform([](std::span<int> Chunk) { return Chunk.size(); }) |
+                     Retro::Ranges::To<std::vector>();
+        CHECK(Sizes == std::vector<size_t>{4, 4, 2});
+    }
+}
@@ -44,6 +44,12 @@ namespace Retro::Ranges::Testing {
         }
     };
 
+    static TPooledGenerator<int> GeneratePooledIntegers(int Num) {
+        for (int i = 0; i < Num; i++) {
+            co_yield i;
+        }
+    }
+
     TGenerator<int> GenerateInts(int Start) {
         while (true) {
             co_yield Start;
@@ -84,6 +90,24 @@ TEST_CASE("Can create a lazily evaluated generator", "[ranges]") {
         }
         CHECK(Values == std::vector({'A', 'B', 'C', 'D', 'E', 'F', 'G'}));
     }
+
+    SECTION("Pooled generators reuse the frames of previous generators") {
+        Retro::FGeneratorFramePool::Trim();
+        Retro::FGeneratorFramePool::ResetStats();
+
+        for (int i = 0; i < 3; i++) {
+            auto Numbers = GeneratePooledIntegers(4) | Retro::Ranges::To<std::vector>();
+            CHECK(Numbers == std::vector({0, 1, 2, 3}));
+        }
+
+        auto Stats = Retro::FGeneratorFramePool::GetStats();
+        CHECK(Stats.Misses == 1);
+        CHECK(Stats.Hits == 2);
+        CHECK(Stats.CachedFrames == 1);
+
+        Retro::FGeneratorFramePool::Trim();
+        CHECK(Retro::FGeneratorFramePool::GetStats().CachedFrames == 0);
+    }
 }
 
 #ifdef __UNREAL__
@@ -15,6 +15,8 @@ import RetroLib;
 #include "RetroLib.h"
 
 #include <array>
+#include <forward_list>
+#include <list>
 #include <map>
 #include <string>
 #include <string_view>
@@ -130,6 +132,75 @@ TEST_CASE_NAMED(FConcatViewTest, "RetroLib::Ranges::Views::Concat", "[ranges]")
         CHECK(Sum == 55);
     }
 
+    SECTION("Can be traversed one segment at a time") {
+        auto View = Retro::Ranges::Views::Concat(Range1, Range2, Retro::Ranges::Views::Concat(Range2, Range1));
+        static_assert(Retro::Ranges::SegmentedRange<decltype(View)>);
+        std::vector<size_t> Sizes;
+        CHECK(Retro::Ranges::ForEachSegment(View, [&Sizes](auto &Segment) {
+            Sizes.push_back(std::ranges::size(Segment));
+            return true;
+        }));
+        CHECK(Sizes == std::vector<size_t>({5, 5, 5, 5}));
+
+        int Visited = 0;
+        CHECK_FALSE(Retro::Ranges::ForEachSegment(std::as_const(View), [&Visited](auto &) { return ++Visited < 2; }));
+        CHECK(Visited == 2);
+
+        CHECK(Retro::Ranges::Reduce(View, 0, std::plus{}) == 110);
+        CHECK((View | Retro::Ranges::TransformReduce(0, Retro::Add, [](int i) { return i * 2; })) == 220);
+        CHECK((View | Retro::Ranges::To<std::vector>()) ==
+              std::vector({1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 6, 7, 8, 9, 10, 1, 2, 3, 4, 5}));
+        auto [Sum, Max] = View | Retro::Ranges::ReduceMany(Retro::Ranges::Reducer(0, std::plus{}),
+                                                           Retro::Ranges::Reducer(0, [](int a, int b) {
+                                                               return std::max(a, b);
+                                                           }));
+        CHECK(Sum == 110);
+        CHECK(Max == 10);
+    }
+
+    SECTION("Can seek directly to any element") {
+        std::vector<int> Empty;
+        auto View = Retro::Ranges::Views::Concat(Empty, Range1, Empty, Empty, Range2, Empty);
+        static_assert(std::ranges::random_access_range<decltype(View)>);
+        CHECK(View.size() == 10);
+        for (int i = 0; i < 10; i++) {
+            CHECK(View[i] == i + 1);
+            CHECK(View.begin() + i - View.begin() == i);
+        }
+
+        auto It = View.begin() + 7;
+        CHECK(*It == 8);
+        It -= 6;
+        CHECK(*It == 2);
+        It += 9;
+        CHECK(It == View.end());
+        CHECK(View.end() - View.begin() == 10);
+        CHECK(*std::ranges::lower_bound(View, 6) == 6);
+    }
+
+    SECTION("Ranges with the same iterator type share a single iterator") {
+        std::vector<int> Empty;
+        auto View = Retro::Ranges::Views::Concat(Range2, Empty, Range2);
+        std::vector<int> Values;
+        for (auto It = View.begin(); It != View.end(); ++It) {
+            Values.push_back(*It);
+        }
+        CHECK(Values == std::vector{6, 7, 8, 9, 10, 6, 7, 8, 9, 10});
+        CHECK(*(View.end() - 6) == 10);
+        CHECK(*--View.end() == 10);
+    }
+
+    SECTION("Can end with a range that uses a sentinel") {
+        auto View = Retro::Ranges::Views::Concat(
+            Range1, std::ranges::views::iota(6) | std::ranges::views::take_while([](int i) { return i <= 10; }));
+        static_assert(!std::ranges::common_range<decltype(View)>);
+        int Sum = 0;
+        for (int Value : View) {
+            Sum += Value;
+        }
+        CHECK(Sum == 55);
+    }
+
     SECTION("Can use an iterator based view setup, skipping numbers") {
         auto View = Retro::Ranges::Views::Concat(Range1, Range2);
         int Sum = 0;
@@ -186,6 +257,97 @@ TEST_CASE_NAMED(FConcatViewTest, "RetroLib::Ranges::Views::Concat", "[ranges]")
     }
 }
 
+TEST_CASE_NAMED(FConcatAllViewTest, "RetroLib::Ranges::Views::ConcatAll", "[ranges]") {
+    std::vector<std::vector<int>> Buffers = {{1, 2, 3}, {}, {4}, {}, {}, {5, 6, 7, 8}, {}};
+
+    SECTION("Iterates over every segment in order, skipping empty ones") {
+        auto View = Buffers | Retro::Ranges::Views::ConcatAll;
+        static_assert(std::ranges::random_access_range<decltype(View)>);
+        static_assert(std::ranges::sized_range<decltype(View)>);
+        static_assert(Retro::Ranges::SegmentedRange<decltype(View)>);
+        CHECK(View.size() == 8);
+        CHECK(std::ranges::equal(View, std::views::iota(1, 9)));
+        CHECK(std::ranges::equal(View | std::views::reverse, std::views::iota(1, 9) | std::views::reverse));
+    }
+
+    SECTION("Supports random access across segments") {
+        auto View = Retro::Ranges::Views::ConcatAll(Buffers);
+        for (int i = 0; i < 8; i++) {
+            CHECK(View[i] == i + 1);
+        }
+
+        auto It = View.begin() + 5;
+        CHECK(*It == 6);
+        It -= 4;
+        CHECK(*It == 2);
+        It += 2;
+        CHECK(*It == 4);
+        CHECK(It - View.begin() == 3);
+        CHECK(View.end() - It == 5);
+        CHECK(It + 5 == View.end());
+        CHECK(View.begin() < It);
+        CHECK(std::ranges::lower_bound(View, 5) - View.begin() == 4);
+
+        View[6] = 70;
+        CHECK(Buffers[5][2] == 70);
+    }
+
+    SECTION("Can be reduced and collected one segment at a time") {
+        const auto View = Retro::Ranges::Views::ConcatAll(Buffers);
+        CHECK(Retro::Ranges::Reduce(View, 0, std::plus{}) == 36);
+        CHECK((View | Retro::Ranges::To<std::vector>()) == std::vector({1, 2, 3, 4, 5, 6, 7, 8}));
+
+        int Segments = 0;
+        Retro::Ranges::ForEachSegment(View, [&Segments](auto &) {
+            Segments++;
+            return true;
+        });
+        CHECK(Segments == 7);
+    }
+
+    SECTION("Works with segments that are not random access") {
+        std::vector<std::list<int>> Lists = {{1, 2}, {}, {3}};
+        auto View = Retro::Ranges::Views::ConcatAll(Lists);
+        static_assert(std::ranges::sized_range<decltype(View)>);
+        static_assert(std::ranges::bidirectional_range<decltype(View)>);
+        static_assert(!std::ranges::random_access_range<decltype(View)>);
+        CHECK(View.size() == 3);
+        CHECK(std::ranges::equal(View, std::array{1, 2, 3}));
+        CHECK(*std::ranges::prev(View.end()) == 3);
+
+        std::vector<std::forward_list<int>> ForwardLists = {{1, 2}, {}, {3}};
+        auto ForwardView = Retro::Ranges::Views::ConcatAll(ForwardLists);
+        static_assert(!std::ranges::sized_range<decltype(ForwardView)>);
+        CHECK(std::ranges::equal(ForwardView, std::array{1, 2, 3}));
+        CHECK((ForwardView | Retro::Ranges::To<std::vector>()) == std::vector({1, 2, 3}));
+    }
+
+    SECTION("Segment sizes are read again when iteration restarts") {
+        auto View = Retro::Ranges::Views::ConcatAll(Buffers);
+        CHECK(View.size() == 8);
+
+        Buffers[1].push_back(10);
+        auto Copy = View;
+        CHECK(Copy.size() == 9);
+        CHECK(Copy[3] == 10);
+
+        CHECK(View.begin()[3] == 10);
+        CHECK(View.size() == 9);
+
+        auto NonEmpty = Buffers | std::views::filter([](const std::vector<int> &Buffer) { return !Buffer.empty(); }) |
+                        Retro::Ranges::Views::ConcatAll;
+        CHECK(NonEmpty.size() == 9);
+        CHECK(std::ranges::distance(NonEmpty) == 9);
+    }
+
+    SECTION("An empty range of ranges is an empty view") {
+        std::vector<std::vector<int>> Empty;
+        auto View = Retro::Ranges::Views::ConcatAll(Empty);
+        CHECK(View.empty());
+        CHECK(View.begin() == View.end());
+    }
+}
+
 TEST_CASE_NAMED(FCacheLastViewTest, "RetroLib::Ranges::Views::CacheLast", "[ranges]") {
     std::array Values = {1, 2, 3, 4, 5};
     constexpr auto Transformer = [](int Value) {
@@ -270,6 +432,38 @@ TEST_CASE_NAMED(FJoinWithViewTest, "RetroLib::Ranges::Views::JoinWith", "[ranges
         auto Joined = Strings | Retro::Ranges::Views::JoinWith(Constraction) | Retro::Ranges::To<std::string>();
         CHECK(Joined == "1, 2, 3, 4");
     }
+
+    SECTION("Can join ranges that have the same iterator type as the separator") {
+        std::vector<std::vector<int>> Values = {{1, 2}, {}, {3}, {}};
+        std::vector Separator = {0, -1};
+        auto Joined = Values | Retro::Ranges::Views::JoinWith(Separator) | Retro::Ranges::To<std::vector>();
+        CHECK(Joined == std::vector{1, 2, 0, -1, 0, -1, 3, 0, -1});
+    }
+
+    SECTION("Can be traversed one piece at a time") {
+        using namespace std::literals;
+
+        std::vector<std::string> Words = {"alpha", "", "gamma"};
+        auto View = Words | Retro::Ranges::Views::JoinWith(", "sv);
+        static_assert(Retro::Ranges::SegmentedRange<decltype(View)>);
+        std::vector<std::string> Pieces;
+        CHECK(Retro::Ranges::ForEachSegment(View, [&Pieces](auto &Segment) {
+            Pieces.emplace_back(std::ranges::begin(Segment), std::ranges::end(Segment));
+            return true;
+        }));
+        CHECK(Pieces == std::vector<std::string>{"alpha", ", ", "", ", ", "gamma"});
+
+        int Visited = 0;
+        CHECK_FALSE(Retro::Ranges::ForEachSegment(View, [&Visited](auto &) { return ++Visited < 2; }));
+        CHECK(Visited == 2);
+
+        auto Joined = View | Retro::Ranges::To<std::string>();
+        CHECK(Joined == "alpha, , gamma");
+        CHECK(Retro::Ranges::Reduce(View, 0, [](int Count, char) { return Count + 1; }) == 14);
+
+        std::vector<std::string> Empty;
+        CHECK((Empty | Retro::Ranges::Views::JoinWith(", "sv) | Retro::Ranges::To<std::string>()).empty());
+    }
 }
 
 TEST_CASE_NAMED(FElementsTest, "RetroLib::Ranges::Views::Elements", "[ranges]") {
@@ -369,4 +563,56 @@ TEST_CASE_NAMED(FReverseEnumerateTest, "RetroLib::Ranges::Views::ReverseEnumerat
 
         CHECK(Pairs == std::map<int, char>{{2, 'C'}, {3, 'D'}, {4, 'E'}});
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE_NAMED(FSizeHintTest, "RetroLib::Ranges::SizeHint", "[ranges]") {
+    std::vector Numbers = {1, 2, 3, 4, 5, 6};
+    auto IsEven = [](int Value) { return Value % 2 == 0; };
+
+    SECTION("Sized ranges report their exact size and filters report an upper bound") {
+        CHECK(Retro::Ranges::SizeHint(Numbers) == Retro::Ranges::FSizeHint::Exact(6));
+
+        auto Filtered = Numbers | Retro::Ranges::Views::Filter(IsEven);
+        CHECK(Retro::Ranges::SizeHint(Filtered) == Retro::Ranges::FSizeHint{0, 6});
+
+        auto Transformed = Filtered | std::views::transform([](int Value) { return Value * 2; });
+        CHECK(Retro::Ranges::SizeHint(Transformed) == Retro::Ranges::FSizeHint{0, 6});
+
+        auto Generated = std::views::iota(0) | std::views::take_while([](int Value) { return Value < 4; });
+        CHECK(Retro::Ranges::SizeHint(Generated) == Retro::Ranges::FSizeHint{});
+    }
+
+    SECTION("The library's views propagate the hints of their parts") {
+        std::array Extra = {7, 8};
+        auto Concatenated = Retro::Ranges::Views::Concat(Numbers | Retro::Ranges::Views::Filter(IsEven), Extra);
+        CHECK(Retro::Ranges::SizeHint(Concatenated) == Retro::Ranges::FSizeHint{2, 8});
+
+        auto Enumerated = Numbers | Retro::Ranges::Views::Filter(IsEven) | Retro::Ranges::Views::Enumerate;
+        CHECK(Retro::Ranges::SizeHint(Enumerated) == Retro::Ranges::FSizeHint{0, 6});
+
+        auto Cached = Numbers | Retro::Ranges::Views::Filter(IsEven) | Retro::Ranges::Views::CacheLast;
+        CHECK(Retro::Ranges::SizeHint(Cached) == Retro::Ranges::FSizeHint{0, 6});
+
+        std::vector<std::pair<int, int>> Pairs = {{1, 2}, {3, 4}};
+        auto Keys = Pairs | Retro::Ranges::Views::Filter([](auto &Pair) { return Pair.first > 1; }) |
+                    Retro::Ranges::Views::Keys;
+        CHECK(Retro::Ranges::SizeHint(Keys) == Retro::Ranges::FSizeHint{0, 2});
+    }
+
+    SECTION("Joining a filtered range of strings gives an exact hint that To can reserve") {
+        std::vector<std::string> Words = {"alpha", "beta", "gamma", "delta"};
+        auto Joined = Words | Retro::Ranges::Views::Filter([](const std::string &Word) { return Word.size() == 5; }) |
+                      Retro::Ranges::Views::JoinWith(", ");
+        static_assert(!std::ranges::sized_range<decltype(Joined)>);
+        CHECK(Retro::Ranges::SizeHint(Joined) == Retro::Ranges::FSizeHint::Exact(19));
+
+        auto Result = Joined | Retro::Ranges::To<std::vector>();
+        CHECK(std::string_view(Result.data(), Result.size()) == "alpha, gamma, delta");
+        CHECK(Result.capacity() == 19);
+
+        std::vector<std::string> Lines(8, std::string(10, 'x'));
+        auto Csv = Lines | Retro::Ranges::Views::JoinWith(std::string_view(",")) | Retro::Ranges::To<std::string>();
+        CHECK(Csv.size() == 87);
+        CHECK(Csv.capacity() == 87);
+    }
+}
@@ -0,0 +1,93 @@
+/**
+ * @file FlatMapTest.cpp
+ * @brief Test for the FlatMap class
+ *
+ * @author Retro & Chill
+ * https://github.com/retroandchill
+ */
+#include "TestAdapter.h"
+
+#if RETROLIB_WITH_MODULES
+import std;
+import RetroLib;
+#else
+#include "RetroLib.h"
+
+#include <functional>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#endif
+
+TEST_CASE_NAMED(FFlatMapTest, "Retro::FlatMap", "[utils]") {
+    SECTION("Entries are kept sorted and can be looked up") {
+        Retro::TFlatMap<int, std::string> Map;
+        CHECK(Map.empty());
+        CHECK(Map.TryEmplace(3, "three"));
+        CHECK(Map.TryEmplace(1, "one"));
+        CHECK(Map.TryEmplace(2, "two"));
+        CHECK_FALSE(Map.TryEmplace(2, "other"));
+
+        CHECK(Map.size() == 3);
+        CHECK(Map.begin()->first == 1);
+        REQUIRE(Map.Find(2) != nullptr);
+        CHECK(*Map.Find(2) == "two");
+        CHECK(Map.Find(4) == nullptr);
+        CHECK(Map.Contains(3));
+        CHECK_FALSE(Map.Contains(0));
+
+        *Map.Find(1) = "uno";
+        CHECK(std::as_const(Map).Find(1)->compare("uno") == 0);
+    }
+
+    SECTION("Inserting a range merges it with the existing entries and keeps the first duplicate") {
+        Retro::TFlatMap<int, int, std::greater<>> Map;
+        Map.InsertRange(std::vector<std::pair<int, int>>{{2, 0}, {4, 1}});
+        Map.InsertRange(std::vector<std::pair<int, int>>{{5, 2}, {2, 3}, {1, 4}, {5, 5}});
+
+        auto Data = Map.GetData();
+        REQUIRE(Data.size() == 4);
+        CHECK(Data[0] == std::pair(5, 2));
+        CHECK(Data[1] == std::pair(4, 1));
+        CHECK(Data[2] == std::pair(2, 0));
+        CHECK(Data[3] == std::pair(1, 4));
+
+        Map.Clear();
+        CHECK(Map.empty());
+        CHECK(Map.GetCapacity() >= 4);
+    }
+
+    SECTION("Inserting a range leaves the map unchanged if reading the range throws") {
+        Retro::TFlatMap<int, int> Map;
+        Map.InsertRange(std::vector<std::pair<int, int>>{{3, 0}, {1, 1}});
+        Map.InsertRange(Map);
+        CHECK(Map.size() == 2);
+
+        auto Throwing = std::views::iota(0, 4) | std::views::transform([](int Value) {
+                            if (Value == 2) {
+                                throw std::runtime_error("Failed to read");
+                            }
+                            return std::pair(Value * 2, Value);
+                        });
+        CHECK_THROWS_AS(Map.InsertRange(Throwing), std::runtime_error);
+        CHECK(Map.GetData().size() == 2);
+        CHECK(Map.GetData()[0] == std::pair(1, 1));
+        CHECK(Map.GetData()[1] == std::pair(3, 0));
+
+        Retro::TFlatMap<int, int> Empty;
+        CHECK_THROWS_AS(Empty.InsertRange(Throwing), std::runtime_error);
+        CHECK(Empty.empty());
+    }
+
+    SECTION("Can be assigned to from a range while reusing its storage") {
+        Retro::TFlatMap<int, int> Map;
+        Map.Reserve(8);
+        std::vector<std::pair<int, int>> Pairs = {{2, 0}, {1, 1}};
+        Pairs | Retro::Ranges::AssignTo(Map);
+        Pairs | Retro::Ranges::AssignTo(Map);
+        CHECK(Map.size() == 2);
+        CHECK(Map.GetCapacity() == 8);
+    }
+}
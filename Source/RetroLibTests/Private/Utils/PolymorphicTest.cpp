@@ -15,6 +15,7 @@ import RetroLib;
 
 #include <array>
 #include <memory>
+#include <memory_resource>
 #endif
 
 class Base {
@@ -85,6 +86,43 @@ class Derived3 : public Base {
     std::shared_ptr<int> Value;
 };
 
+class FRelocatableDerived : public Base {
+  public:
+    explicit FRelocatableDerived(int Value) : Value(Value) {
+    }
+
+    int GetValue() const override {
+        return Value;
+    }
+
+  private:
+    int Value;
+};
+
+template <>
+struct Retro::TIsTriviallyRelocatable<FRelocatableDerived> : std::true_type {};
+
+class FCountingResource : public std::pmr::memory_resource {
+  public:
+    int Allocations = 0;
+    int Deallocations = 0;
+
+  protected:
+    void *do_allocate(size_t Bytes, size_t Alignment) override {
+        Allocations++;
+        return std::pmr::new_delete_resource()->allocate(Bytes, Alignment);
+    }
+
+    void do_deallocate(void *Ptr, size_t Bytes, size_t Alignment) override {
+        Deallocations++;
+        std::pmr::new_delete_resource()->deallocate(Ptr, Bytes, Alignment);
+    }
+
+    bool do_is_equal(const memory_resource &Other) const noexcept override {
+        return this == &Other;
+    }
+};
+
 constexpr std::array ValueArray1 = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15};
 constexpr std::array ValueArray2 = {2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30};
 
@@ -154,6 +192,160 @@ TEST_CASE_NAMED(FPolymorphicCopyTest, "RetroLib::Utils::Polymorphic::Copying", "
     CHECK(Dereferenced3.GetValue() == 120);
 }
 
+TEST_CASE_NAMED(FPolymorphicAllocatorTest, "RetroLib::Utils::Polymorphic::Allocators", "[utils]") {
+    FCountingResource Resource;
+
+    SECTION("Large values are allocated from the memory resource") {
+        Retro::TPmrPolymorphic<Base> Small(std::allocator_arg, &Resource, std::in_place_type<Derived1>, 4);
+        CHECK(Small->GetValue() == 4);
+        CHECK(Resource.Allocations == 0);
+
+        {
+            Retro::TPmrPolymorphic<Base> Large(std::allocator_arg, &Resource, std::in_place_type<Derived2>,
+                                               ValueArray1);
+            CHECK(Large->GetValue() == 120);
+            CHECK(Large.GetAllocator().resource() == &Resource);
+            CHECK(Resource.Allocations == 1);
+
+            Large.Emplace<Derived2>(ValueArray2);
+            CHECK(Large->GetValue() == 240);
+            CHECK(Resource.Allocations == 2);
+            CHECK(Resource.Deallocations == 1);
+        }
+        CHECK(Resource.Deallocations == 2);
+    }
+
+    SECTION("Copies and moves follow the allocator propagation rules") {
+        Retro::TPmrPolymorphic<Base> Original(std::allocator_arg, &Resource, std::in_place_type<Derived2>,
+                                              ValueArray1);
+
+        // Polymorphic allocators are not propagated on copy, so a plain copy goes to the default resource
+        Retro::TPmrPolymorphic<Base> Copy = Original;
+        CHECK(Copy->GetValue() == 120);
+        CHECK(Copy.GetAllocator().resource() != &Resource);
+        CHECK(Resource.Allocations == 1);
+
+        Retro::TPmrPolymorphic<Base> ArenaCopy(std::allocator_arg, &Resource, Original);
+        CHECK(ArenaCopy->GetValue() == 120);
+        CHECK(ArenaCopy.GetAllocator().resource() == &Resource);
+        CHECK(Resource.Allocations == 2);
+
+        Retro::TPmrPolymorphic<Base> Moved = std::move(ArenaCopy);
+        CHECK(Moved->GetValue() == 120);
+        CHECK(Moved.GetAllocator().resource() == &Resource);
+
+        // Assignment keeps the allocator of the target
+        Copy = Moved;
+        CHECK(Copy.GetAllocator().resource() != &Resource);
+        CHECK(Copy->GetValue() == 120);
+    }
+}
+
+TEST_CASE_NAMED(FPolymorphicRelocationTest, "RetroLib::Utils::Polymorphic::Relocation", "[utils]") {
+    static_assert(Retro::IsTriviallyRelocatable<FRelocatableDerived>);
+    static_assert(!Retro::IsTriviallyRelocatable<Derived3>);
+
+    SECTION("Moving a large value leaves the source holding a valid value") {
+        Retro::TPolymorphic<Base> Original(std::in_place_type<Derived2>, ValueArray1);
+        Retro::TPolymorphic<Base> Moved = std::move(Original);
+        CHECK(Moved->GetValue() == 120);
+        CHECK(Original->GetValue() == 120);
+
+        Original = Derived1(5);
+        CHECK(Original->GetValue() == 5);
+    }
+
+    SECTION("Move assignment swaps values that can be relocated") {
+        std::array<int, 15> Ones;
+        Ones.fill(1);
+        Retro::TPolymorphic<Base> First(std::in_place_type<Derived2>, ValueArray1);
+        Retro::TPolymorphic<Base> Second(std::in_place_type<Derived2>, Ones);
+        const Base *FirstAddress = std::as_const(First).Get();
+        const Base *SecondAddress = std::as_const(Second).Get();
+
+        Second = std::move(First);
+        CHECK(std::as_const(Second).Get() == FirstAddress);
+        CHECK(Second->GetValue() == 120);
+        CHECK(std::as_const(First).Get() == SecondAddress);
+        CHECK(First->GetValue() == 15);
+
+        Retro::TPolymorphic<Base> Relocatable(std::in_place_type<FRelocatableDerived>, 7);
+        Retro::TPolymorphic<Base> RelocatedTo(std::in_place_type<FRelocatableDerived>, 8);
+        RelocatedTo = std::move(Relocatable);
+        CHECK(RelocatedTo->GetValue() == 7);
+        CHECK(Relocatable->GetValue() == 8);
+    }
+
+    SECTION("Values that can't be relocated are moved") {
+        auto Value = std::make_shared<int>(9);
+        std::weak_ptr<int> WeakValue = Value;
+        Retro::TPolymorphic<Base> NonRelocatable(std::in_place_type<Derived3>, std::move(Value));
+        Retro::TPolymorphic<Base> MovedTo = std::move(NonRelocatable);
+        CHECK(MovedTo->GetValue() == 9);
+
+        NonRelocatable = Derived1(5);
+        CHECK(NonRelocatable->GetValue() == 5);
+
+        MovedTo = Retro::TPolymorphic<Base>(std::in_place_type<FRelocatableDerived>, 7);
+        CHECK(MovedTo->GetValue() == 7);
+        CHECK(WeakValue.expired());
+    }
+
+    SECTION("Large values are not relocated between different allocators") {
+        FCountingResource Resource;
+        Retro::TPmrPolymorphic<Base> Arena(std::allocator_arg, &Resource, std::in_place_type<Derived2>, ValueArray1);
+        Retro::TPmrPolymorphic<Base> Target;
+
+        Target = std::move(Arena);
+        CHECK(Target->GetValue() == 120);
+        CHECK(Target.GetAllocator().resource() != &Resource);
+        CHECK(Resource.Allocations == 1);
+        CHECK(Arena->GetValue() == 120);
+    }
+}
+
+TEST_CASE_NAMED(FPolymorphicCopyOnWriteTest, "RetroLib::Utils::Polymorphic::CopyOnWrite", "[utils]") {
+    SECTION("Copies of large values share storage until mutated") {
+        Retro::TCowPolymorphic<Base> Original(std::in_place_type<Derived2>, ValueArray1);
+        const auto &ConstOriginal = Original;
+        auto Copy = Original;
+        const auto &ConstCopy = Copy;
+        CHECK(ConstCopy.Get() == ConstOriginal.Get());
+        CHECK(ConstCopy->GetValue() == 120);
+        CHECK(ConstCopy.Get() == ConstOriginal.Get());
+
+        // Mutable access to a shared value clones it, after which the value is unique and stays put
+        Base *Mutable = Copy.Get();
+        CHECK(Mutable != ConstOriginal.Get());
+        CHECK(Mutable->GetValue() == 120);
+        CHECK(Copy.Get() == Mutable);
+
+        // The original is now the only owner of its value, so it does not need to clone either
+        const Base *OriginalValue = ConstOriginal.Get();
+        CHECK(Original.Get() == OriginalValue);
+    }
+
+    SECTION("Assignment and moves share and release storage") {
+        auto Value = std::make_shared<int>(8);
+        std::weak_ptr<int> WeakValue = Value;
+        Retro::TCowPolymorphic<Base, sizeof(void *)> Polymorphic1(std::in_place_type<Derived3>, std::move(Value));
+        Retro::TCowPolymorphic<Base, sizeof(void *)> Polymorphic2(std::in_place_type<Derived2>, ValueArray1);
+
+        Polymorphic2 = Polymorphic1;
+        CHECK(std::as_const(Polymorphic2).Get() == std::as_const(Polymorphic1).Get());
+        CHECK(Polymorphic2->GetValue() == 8);
+
+        auto Polymorphic3 = std::move(Polymorphic1);
+        CHECK(std::as_const(Polymorphic3)->GetValue() == 8);
+
+        Polymorphic1.Emplace<Derived1>(3);
+        Polymorphic2.Emplace<Derived1>(4);
+        CHECK_FALSE(WeakValue.expired());
+        Polymorphic3.Emplace<Derived1>(5);
+        CHECK(WeakValue.expired());
+    }
+}
+
 #ifdef __UNREAL__
 TEST_CASE_NAMED(FPolymorphicOptionalState, "RetroLib::Utils::Polymorphic::IntrusiveOptional", "[utils]") {
     static_assert(sizeof(Retro::TPolymorphic<Base>) == sizeof(TOptional<Retro::TPolymorphic<Base>>));
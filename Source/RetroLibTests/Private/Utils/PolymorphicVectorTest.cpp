@@ -0,0 +1,194 @@
+/**
+ * @file PolymorphicVectorTest.cpp
+ * @brief Test for the PolymorphicVector class
+ *
+ * @author Retro & Chill
+ * https://github.com/retroandchill
+ */
+#include "TestAdapter.h"
+
+#if RETROLIB_WITH_MODULES
+import std;
+import RetroLib;
+#else
+#include "RetroLib.h"
+
+#include <array>
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <typeinfo>
+#include <vector>
+#endif
+
+namespace {
+    class FComponent {
+      public:
+        virtual ~FComponent() = default;
+
+        virtual int GetValue() const = 0;
+
+        virtual void Update() = 0;
+    };
+
+    class FCounter final : public FComponent {
+      public:
+        explicit FCounter(int Value) : Value(Value) {
+        }
+
+        int GetValue() const override {
+            return Value;
+        }
+
+        void Update() override {
+            Value++;
+        }
+
+      private:
+        int Value;
+    };
+
+    class FNamed final : public FComponent {
+      public:
+        explicit FNamed(std::string Name) : Name(std::move(Name)) {
+        }
+
+        int GetValue() const override {
+            return static_cast<int>(Name.size());
+        }
+
+        void Update() override {
+            Name += '!';
+        }
+
+      private:
+        std::string Name;
+    };
+
+    class FTagged {
+      public:
+        virtual ~FTagged() = default;
+
+        std::array<int, 3> Tags = {1, 2, 3};
+    };
+
+    // Uses multiple inheritance so that the base class is not at the start of the object
+    class FTaggedCounter final : public FTagged, public FComponent {
+      public:
+        explicit FTaggedCounter(std::shared_ptr<int> Value) : Value(std::move(Value)) {
+        }
+
+        int GetValue() const override {
+            return *Value;
+        }
+
+        void Update() override {
+            (*Value)++;
+        }
+
+      private:
+        std::shared_ptr<int> Value;
+    };
+} // namespace
+
+TEST_CASE_NAMED(FPolymorphicVectorTest, "RetroLib::Utils::PolymorphicVector", "[utils]") {
+    static_assert(std::ranges::forward_range<Retro::TPolymorphicVector<FComponent>>);
+    static_assert(std::ranges::sized_range<Retro::TPolymorphicVector<FComponent>>);
+
+    Retro::TPolymorphicVector<FComponent> Components;
+    auto Shared = std::make_shared<int>(10);
+    std::weak_ptr<int> WeakShared = Shared;
+    for (int i = 0; i < 10; i++) {
+        Components.Emplace<FCounter>(i);
+        Components.Add(FNamed(std::string(i, 'a')));
+    }
+    Components.Emplace<FTaggedCounter>(std::move(Shared));
+    REQUIRE(Components.size() == 21);
+
+    SECTION("Elements of the same type are stored contiguously") {
+        auto Counters = Components.GetSegment<FCounter>();
+        REQUIRE(Counters.size() == 10);
+        for (int i = 0; i < 10; i++) {
+            CHECK(Counters[i].GetValue() == i);
+        }
+        CHECK(std::as_const(Components).GetSegment<FNamed>().size() == 10);
+        CHECK(Components.GetSegment<FTaggedCounter>().size() == 1);
+    }
+
+    SECTION("Can iterate over every element through the base class") {
+        int Sum = 0;
+        for (const FComponent &Component : std::as_const(Components)) {
+            Sum += Component.GetValue();
+        }
+        CHECK(Sum == 100);
+
+        for (FComponent &Component : Components) {
+            Component.Update();
+        }
+        auto Values = Components | Retro::Ranges::Views::Transform(&FComponent::GetValue) |
+                      Retro::Ranges::To<std::vector>();
+        CHECK(Values.size() == 21);
+        CHECK(Values.back() == 11);
+    }
+
+    SECTION("ForEach passes the listed types as their concrete type") {
+        int Concrete = 0;
+        int Erased = 0;
+        Components.ForEach<FCounter, FNamed>([&](auto &Component) {
+            using FType = std::decay_t<decltype(Component)>;
+            if constexpr (std::same_as<FType, FCounter>) {
+                Component.Update();
+                Concrete++;
+            } else if constexpr (std::same_as<FType, FNamed>) {
+                Concrete++;
+            } else {
+                CHECK(typeid(Component) == typeid(FTaggedCounter));
+                Erased++;
+            }
+        });
+        CHECK(Concrete == 20);
+        CHECK(Erased == 1);
+        CHECK(Components.GetSegment<FCounter>()[0].GetValue() == 1);
+    }
+
+    SECTION("Copies and moves keep every element") {
+        auto Copy = Components;
+        CHECK(Copy.size() == 21);
+        CHECK(Copy.GetSegment<FNamed>()[9].GetValue() == 9);
+
+        Retro::TPolymorphicVector<FComponent> Moved = std::move(Copy);
+        CHECK(Moved.size() == 21);
+        CHECK(Copy.empty());
+
+        Components.Clear();
+        CHECK(Components.empty());
+        CHECK(Components.begin() == Components.end());
+        CHECK_FALSE(WeakShared.expired());
+
+        Moved = Retro::TPolymorphicVector<FComponent>();
+        CHECK(WeakShared.expired());
+    }
+}
+
+TEST_CASE_NAMED(FPolymorphicVectorAllocatorTest, "RetroLib::Utils::PolymorphicVector::Allocators", "[utils]") {
+    static_assert(std::is_nothrow_move_assignable_v<Retro::TPolymorphicVector<FComponent>>);
+    static_assert(!std::is_nothrow_move_assignable_v<Retro::TPmrPolymorphicVector<FComponent>>);
+
+    std::pmr::monotonic_buffer_resource Resource;
+    Retro::TPmrPolymorphicVector<FComponent> Components(&Resource);
+    Components.Reserve<FCounter>(8);
+    for (int i = 0; i < 8; i++) {
+        Components.Emplace<FCounter>(i);
+    }
+
+    auto Segment = Components.GetSegment<FCounter>();
+    CHECK(Components.GetAllocator().resource() == &Resource);
+    CHECK(Segment.size() == 8);
+    CHECK(Segment[7].GetValue() == 7);
+
+    Retro::TPmrPolymorphicVector<FComponent> Other;
+    Other = std::move(Components);
+    CHECK(Other.GetAllocator().resource() != &Resource);
+    CHECK(Other.GetSegment<FCounter>()[7].GetValue() == 7);
+    CHECK(Components.empty());
+}
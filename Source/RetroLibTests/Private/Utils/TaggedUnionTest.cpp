@@ -0,0 +1,140 @@
+/**
+ * @file TaggedUnionTest.cpp
+ * @brief Test for the TaggedUnion class
+ *
+ * @author Retro & Chill
+ * https://github.com/retroandchill
+ */
+#include "TestAdapter.h"
+
+#if RETROLIB_WITH_MODULES
+import std;
+import RetroLib;
+#else
+#include "RetroLib.h"
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#endif
+
+namespace {
+    struct FThrowingAlternative {
+        explicit FThrowingAlternative(bool bThrow) {
+            if (bThrow) {
+                throw std::runtime_error("Failed to construct");
+            }
+        }
+    };
+
+    constexpr size_t ActiveIndex(const auto &Union) {
+        return Retro::VisitIndex([]<typename E, size_t I>(Retro::TIndexedElement<E, I>) { return I; }, Union);
+    }
+
+    constexpr int SumAlternatives() {
+        Retro::TTaggedUnion<int, double> Union(std::in_place_index<0>, 3);
+        int Sum = Union.Get<0>();
+        Union.Emplace<1>(4.0);
+        Sum += static_cast<int>(Union.Get<1>());
+        return Sum + static_cast<int>(ActiveIndex(Union));
+    }
+} // namespace
+
+TEST_CASE_NAMED(FTaggedUnionTest, "Retro::TaggedUnion", "[utils]") {
+    using FIteratorUnion = Retro::TTaggedUnion<std::vector<int>::iterator, int *>;
+    using FSharedUnion = Retro::TTaggedUnion<int *, int *>;
+    static_assert(std::is_trivially_copyable_v<FIteratorUnion>);
+    static_assert(std::is_trivially_copyable_v<FSharedUnion>);
+    static_assert(sizeof(FSharedUnion) == sizeof(std::pair<int *, uint8_t>));
+    static_assert(!FIteratorUnion::bSharedAlternative);
+    static_assert(FSharedUnion::bSharedAlternative);
+    static_assert(SumAlternatives() == 8);
+
+    SECTION("Can switch between alternatives") {
+        Retro::TTaggedUnion<int, std::string> Union;
+        CHECK(Union.GetIndex() == 0);
+        CHECK(Union.Get<0>() == 0);
+
+        Union.Emplace<1>("Hello");
+        CHECK(Union.GetIndex() == 1);
+        CHECK(Union.Get<1>() == "Hello");
+        CHECK(ActiveIndex(Union) == 1);
+
+        auto Length = Retro::VisitIndex<size_t>(
+            []<typename E, size_t I>(Retro::TIndexedElement<E, I> Element) {
+                if constexpr (I == 0) {
+                    return static_cast<size_t>(Element.Get());
+                } else {
+                    return Element.Get().size();
+                }
+            },
+            std::as_const(Union));
+        CHECK(Length == 5);
+
+        Union.Emplace<0>(7);
+        CHECK(Union.Get<0>() == 7);
+    }
+
+    SECTION("Copies, moves and destroys alternatives that are not trivial") {
+        auto Value = std::make_shared<int>(3);
+        {
+            Retro::TTaggedUnion<int, std::shared_ptr<int>> Union(std::in_place_index<1>, Value);
+            CHECK(Value.use_count() == 2);
+
+            auto Copy = Union;
+            CHECK(Value.use_count() == 3);
+            CHECK(Copy == Union);
+
+            auto Moved = std::move(Copy);
+            CHECK(Value.use_count() == 3);
+            CHECK(*Moved.Get<1>() == 3);
+
+            Moved = Retro::TTaggedUnion<int, std::shared_ptr<int>>(std::in_place_index<0>, 5);
+            CHECK(Value.use_count() == 2);
+            CHECK(Moved.GetIndex() == 0);
+            CHECK(Moved != Union);
+
+            Moved = Union;
+            CHECK(Value.use_count() == 3);
+        }
+        CHECK(Value.use_count() == 1);
+    }
+
+    SECTION("A throwing constructor leaves the active alternative in place") {
+        auto Value = std::make_shared<int>(3);
+        Retro::TTaggedUnion<std::shared_ptr<int>, FThrowingAlternative> Union(std::in_place_index<0>, Value);
+        CHECK_THROWS_AS(Union.Emplace<1>(true), std::runtime_error);
+        CHECK(Union.GetIndex() == 0);
+        CHECK(Union.Get<0>() == Value);
+        CHECK(Value.use_count() == 2);
+
+        Union.Emplace<1>(false);
+        CHECK(Union.GetIndex() == 1);
+        CHECK(Value.use_count() == 1);
+    }
+
+    SECTION("Alternatives of the same type share their storage") {
+        std::array Values = {1, 2, 3};
+        FSharedUnion Union(std::in_place_index<0>, Values.data());
+        Union.Emplace<1>(Values.data() + 2);
+        CHECK(Union.GetIndex() == 1);
+        CHECK(*Union.GetShared() == 3);
+        CHECK(Union != FSharedUnion(std::in_place_index<0>, Values.data() + 2));
+        CHECK(Union == FSharedUnion(std::in_place_index<1>, Values.data() + 2));
+    }
+
+    SECTION("Can dispatch on more alternatives than fit in a single switch") {
+        using FLargeUnion =
+            Retro::TTaggedUnion<char, signed char, unsigned char, short, unsigned short, int, unsigned, long,
+                                unsigned long, long long, unsigned long long>;
+        FLargeUnion Union;
+        CHECK(ActiveIndex(Union) == 0);
+        Union.Emplace<7>(7L);
+        CHECK(ActiveIndex(Union) == 7);
+        Union.Emplace<10>(10ULL);
+        CHECK(ActiveIndex(Union) == 10);
+        CHECK(Union.Get<10>() == 10);
+    }
+}
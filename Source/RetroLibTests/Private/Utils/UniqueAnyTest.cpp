@@ -14,7 +14,9 @@ import RetroLib;
 #include "RetroLib.h"
 
 #include <array>
+#include <cstdint>
 #include <memory>
+#include <string>
 #endif
 
 TEST_CASE_NAMED(FUniqueAnyTest, "RetroLib::Utils::UniqueAny", "[utils]") {
@@ -62,6 +64,24 @@ TEST_CASE_NAMED(FUniqueAnyTest, "RetroLib::Utils::UniqueAny", "[utils]") {
         CHECK(Any.HasValue());
     }
 
+    SECTION("Small values that are not trivially relocatable are moved through their constructor") {
+        static_assert(Retro::IsTriviallyRelocatable<std::array<int, 4>>);
+        static_assert(!Retro::IsTriviallyRelocatable<std::string>);
+
+        Retro::FUniqueAny Any1 = std::string("Hello world");
+        Retro::FUniqueAny Any2 = std::move(Any1);
+        CHECK_FALSE(Any1.HasValue());
+        CHECK(Any2.Get<std::string>() == "Hello world");
+
+        Retro::FUniqueAny Any3 = std::array{1, 2, 3, 4};
+        Any2 = std::move(Any3);
+        CHECK(Any2.Get<std::array<int, 4>>() == std::array{1, 2, 3, 4});
+
+        Retro::FUniqueAny Empty;
+        Retro::FUniqueAny Any4 = std::move(Empty);
+        CHECK_FALSE(Any4.HasValue());
+    }
+
     SECTION("Moving by assignment invalidates as well") {
         Retro::FUniqueAny Any1(std::in_place_type<std::array<int, 20>>);
 
@@ -71,4 +91,43 @@ TEST_CASE_NAMED(FUniqueAnyTest, "RetroLib::Utils::UniqueAny", "[utils]") {
         CHECK_FALSE(Any1.HasValue());
         CHECK(Any1.GetType() == typeid(void));
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE_NAMED(FUniqueAnyStorageTest, "RetroLib::Utils::UniqueAny::Storage", "[utils]") {
+    struct alignas(32) FVector4 {
+        std::array<double, 4> Components;
+    };
+
+    using FTagAny = Retro::TUniqueAny<16>;
+    using FMathAny = Retro::TUniqueAny<64, 32>;
+
+    static_assert(sizeof(FTagAny) < sizeof(Retro::FUniqueAny));
+    static_assert(FTagAny::FitsSmallStorage<std::array<int, 4>>);
+    static_assert(!FTagAny::FitsSmallStorage<std::array<int, 5>>);
+    static_assert(!Retro::FUniqueAny::FitsSmallStorage<FVector4>);
+    static_assert(FMathAny::FitsSmallStorage<FVector4>);
+    static_assert(FMathAny::FitsSmallStorage<std::array<FVector4, 2>>);
+
+    SECTION("Values are stored inline when they fit") {
+        FTagAny Tag = std::array{1, 2, 3, 4};
+        CHECK(Tag.Get<std::array<int, 4>>() == std::array{1, 2, 3, 4});
+
+        Tag = std::string("Too large for the inline buffer");
+        CHECK(Tag.Get<std::string>() == "Too large for the inline buffer");
+
+        FTagAny Moved = std::move(Tag);
+        CHECK(Moved.Get<std::string>() == "Too large for the inline buffer");
+        CHECK_FALSE(Tag.HasValue());
+    }
+
+    SECTION("Over-aligned values keep their alignment") {
+        FMathAny Math(std::in_place_type<FVector4>, std::array{1.0, 2.0, 3.0, 4.0});
+        auto &Vector = Math.Get<FVector4>();
+        CHECK(reinterpret_cast<std::uintptr_t>(&Vector) % alignof(FVector4) == 0);
+        CHECK(Vector.Components[3] == 4.0);
+
+        Retro::FUniqueAny Any = FVector4{{5.0, 6.0, 7.0, 8.0}};
+        CHECK(reinterpret_cast<std::uintptr_t>(&Any.Get<FVector4>()) % alignof(FVector4) == 0);
+        CHECK(Any.Get<FVector4>().Components[0] == 5.0);
+    }
+}